@@ -0,0 +1,1351 @@
+/************************************************************************/
+/*                                                                      */
+/*  DpmFs.c - Platform MCU / SYZYGY pod filesystem view implementation  */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This source file contains the implementation of a FUSE filesystem   */
+/*  that exposes the state of the board as a tree of files:             */
+/*                                                                      */
+/*      pdid, firmware_version, configuration_version                   */
+/*      platform/{config,enforce5v0,enforce3v3,enforcevio,checkcrc}     */
+/*      vadj/X/{voltage,enabled,power_good,override,enable,             */
+/*              override_voltage,current_allowed,current_requested}     */
+/*      5v0/X/{current_allowed,current_requested}                       */
+/*      3v3/X/{current_allowed,current_requested}                       */
+/*      temp/N/temperature                                              */
+/*      fan/N/{rpm,enable,speed,probe}                                  */
+/*      port/X/{i2c_address,type,status,present,pdid}                   */
+/*      port/X/dna/{manufacturer,product,model,version,serial}          */
+/*      port/X/cal/{factory.bin,user.bin}                               */
+/*                                                                      */
+/*  Platform MCU registers are read through a DpmSession, so each file  */
+/*  is cached for the lifetime of the register class that backs it and  */
+/*  concurrent readers share bus transactions. The DNA and calibration  */
+/*  of a pod are read once and kept until the port's status or I2C      */
+/*  address changes. Writes are performed by the dpmutil set functions  */
+/*  while the session's bus lock is held, after which every register    */
+/*  that may have changed is invalidated.                               */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#if defined(__linux__) && defined(DPMUTIL_FUSE)
+#define FUSE_USE_VERSION	31
+#include <fuse.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <pthread.h>
+#include "dpmutil.h"
+#include "DpmSession.h"
+#include "DpmFs.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+#define cnodeMax			384
+#define cchNodePathMax		48
+#define cchRenderMax		256
+#define cchWriteMax			32
+#define cportMax			8
+#define cchDnaStringMax		255
+
+/* Define the size of the largest calibration record of a pod. Each
+** kind of Zmod has its own record, see FPodRefresh.
+*/
+#define cbPodCalAdcDac		(( sizeof(ZMOD_ADC_CAL) > sizeof(ZMOD_DAC_CAL) ) ? sizeof(ZMOD_ADC_CAL) : sizeof(ZMOD_DAC_CAL))
+#define cbPodCalMax			(( cbPodCalAdcDac > sizeof(ZMOD_DIGITIZER_CAL) ) ? cbPodCalAdcDac : sizeof(ZMOD_DIGITIZER_CAL))
+
+/* Define the kinds of node in the tree.
+*/
+#define ntypeDir			0
+#define ntypeFile			1
+
+/* Define what each file represents.
+*/
+#define nattrNone					0
+#define nattrPdid					1
+#define nattrFirmwareVersion		2
+#define nattrConfigurationVersion	3
+#define nattrPlatformConfig			4
+#define nattrEnforce5v0				5
+#define nattrEnforce3v3				6
+#define nattrEnforceVio				7
+#define nattrCheckCrc				8
+#define nattrVadjVoltage			9
+#define nattrVadjEnabled			10
+#define nattrVadjPowerGood			11
+#define nattrVadjOverride			12
+#define nattrVadjEnable				13
+#define nattrVadjOverrideVoltage	14
+#define nattrVadjCurrentAllowed		15
+#define nattrVadjCurrentRequested	16
+#define nattr5v0CurrentAllowed		17
+#define nattr5v0CurrentRequested	18
+#define nattr3v3CurrentAllowed		19
+#define nattr3v3CurrentRequested	20
+#define nattrTemperature			21
+#define nattrFanRpm					22
+#define nattrFanEnable				23
+#define nattrFanSpeed				24
+#define nattrFanProbe				25
+#define nattrPortI2cAddress			26
+#define nattrPortType				27
+#define nattrPortStatus				28
+#define nattrPortPresent			29
+#define nattrPortPdid				30
+#define nattrDnaManufacturer		31
+#define nattrDnaProduct				32
+#define nattrDnaModel				33
+#define nattrDnaVersion				34
+#define nattrDnaSerial				35
+#define nattrCalFactory				36
+#define nattrCalUser				37
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+typedef struct {
+	char	szPath[cchNodePathMax];
+	BYTE	ntype;
+	BYTE	nattr;
+	BYTE	ival;           // supply, probe, fan or port index
+	BOOL	fWritable;
+} DPMFS_NODE;
+
+/* Contents of a SYZYGY pod that don't change while it's attached.
+*/
+typedef struct {
+	BOOL			fValid;
+	BYTE			addrI2c;
+	BYTE			fsStatus;
+	BOOL			fDna;
+	BOOL			fPdid;
+	BOOL			fCal;
+	char			rgszDna[5][cchDnaStringMax + 1];
+	DWORD			pdid;
+	WORD			cbCal;          // size of the calibration record of the pod
+	BYTE			rgbCalFactory[cbPodCalMax];
+	BYTE			rgbCalUser[cbPodCalMax];
+} DPMFS_POD;
+
+/* ------------------------------------------------------------ */
+/*              Global Variables                                */
+/* ------------------------------------------------------------ */
+
+extern BOOL	dpmutilfVerbose;
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static DPM_SESSION		sessFs;
+static pthread_mutex_t	mtxPod = PTHREAD_MUTEX_INITIALIZER;
+static DPMFS_NODE		rgnode[cnodeMax];
+static DWORD			cnode;
+static DPMFS_POD		rgpod[cportMax];
+static BYTE				cport;
+static BYTE				cvadj;
+static BYTE				c5v0;
+static BYTE				c3v3;
+static BYTE				cprobe;
+static BYTE				cfan;
+
+static const char*	rgszFanSpeed[] = { "minimum", "medium", "maximum", "auto" };
+static const char*	rgszFanProbe[] = { "none", "p1", "p2", "p3", "p4" };
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static BOOL			FBuildTree();
+static void			AddNode(BYTE ntype, BYTE nattr, BYTE ival, BOOL fWritable, const char* szFmt, ...);
+static DPMFS_NODE*	PnodeFind(const char* szPath);
+static BOOL			FRenderNode(DPMFS_NODE* pnode, char* pch, size_t* pcch);
+static int			ErrWriteNode(DPMFS_NODE* pnode, const char* szVal);
+static BOOL			FPodRefresh(BYTE iport, DPMFS_POD* ppod);
+static BOOL			FParseBool(const char* szVal, BOOL* pfVal);
+static BOOL			FParseName(const char* szVal, const char* rgsz[], BYTE cname, BYTE* pival);
+static BOOL			FReadWord(WORD addr, WORD* pw);
+
+static int	DpmFsGetattr(const char* szPath, struct stat* pst, struct fuse_file_info* pfi);
+static int	DpmFsReaddir(const char* szPath, void* pvBuf, fuse_fill_dir_t pfnFill, off_t off, struct fuse_file_info* pfi, enum fuse_readdir_flags flags);
+static int	DpmFsOpen(const char* szPath, struct fuse_file_info* pfi);
+static int	DpmFsRead(const char* szPath, char* pbBuf, size_t cb, off_t off, struct fuse_file_info* pfi);
+static int	DpmFsWrite(const char* szPath, const char* pbBuf, size_t cb, off_t off, struct fuse_file_info* pfi);
+static int	DpmFsTruncate(const char* szPath, off_t off, struct fuse_file_info* pfi);
+
+static const struct fuse_operations	opsDpmFs = {
+	.getattr	= DpmFsGetattr,
+	.readdir	= DpmFsReaddir,
+	.open		= DpmFsOpen,
+	.read		= DpmFsRead,
+	.write		= DpmFsWrite,
+	.truncate	= DpmFsTruncate,
+};
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/***    DpmFsMount
+**
+**  Parameters:
+**      szProg          - name of the program, passed to FUSE as argv[0]
+**      szMountDir      - directory on which to mount the filesystem
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      Fails if the I2C controller can't be opened, if the Platform MCU
+**      doesn't respond or if FUSE fails to mount the filesystem.
+**
+**  Description:
+**      This function discovers the supplies, probes, fans and ports of
+**      the board, builds the file tree and then mounts it. FUSE detaches
+**      the process from the terminal and the function returns once the
+**      filesystem has been unmounted.
+*/
+BOOL
+DpmFsMount(const char* szProg, const char* szMountDir) {
+
+	char*	rgszArg[4];
+	int		cszArg;
+	int		err;
+
+	if ( NULL == szMountDir ) {
+		printf("ERROR: you must specify the directory on which to mount the filesystem\n");
+		return fFalse;
+	}
+
+	if ( ! DpmSessionOpen(&sessFs) ) {
+		printf("ERROR: failed to open file descriptor for I2C device\n");
+		return fFalse;
+	}
+
+	if ( ! FBuildTree() ) {
+		printf("ERROR: failed to read the platform configuration from the PMCU\n");
+		DpmSessionClose(&sessFs);
+		return fFalse;
+	}
+
+	/* The set functions report their progress on stdout, which is of no
+	** use once the filesystem has been detached from the terminal.
+	*/
+	dpmutilfVerbose = fFalse;
+
+	cszArg = 0;
+	rgszArg[cszArg++] = (char*)szProg;
+	rgszArg[cszArg++] = (char*)szMountDir;
+	rgszArg[cszArg++] = "-osubtype=dpmutil,fsname=dpmutil";
+	rgszArg[cszArg] = NULL;
+
+	err = fuse_main(cszArg, rgszArg, &opsDpmFs, NULL);
+
+	DpmSessionClose(&sessFs);
+
+	return ( 0 == err ) ? fTrue : fFalse;
+}
+
+/* ------------------------------------------------------------ */
+/***    FBuildTree
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      Fails if the count registers can't be read.
+**
+**  Description:
+**      This function reads the number of resources of each type from
+**      the Platform MCU and creates a node for every directory and file
+**      of the tree.
+*/
+static BOOL
+FBuildTree() {
+
+	BYTE	i;
+
+	if (( ! DpmSessionPmcuRead(&sessFs, regaddrTempProbeCount, &cprobe, 1, NULL) ) ||
+		( ! DpmSessionPmcuRead(&sessFs, regaddrFanCount, &cfan, 1, NULL) ) ||
+		( ! DpmSessionPmcuRead(&sessFs, regaddr5v0GroupCount, &c5v0, 1, NULL) ) ||
+		( ! DpmSessionPmcuRead(&sessFs, regaddr3v3GroupCount, &c3v3, 1, NULL) ) ||
+		( ! DpmSessionPmcuRead(&sessFs, regaddrVadjGroupCount, &cvadj, 1, NULL) ) ||
+		( ! DpmSessionPmcuRead(&sessFs, regaddrPortCount, &cport, 1, NULL) )) {
+		return fFalse;
+	}
+
+	/* Clamp the counts to the number of register sets defined by the
+	** register map.
+	*/
+	if ( 4 < cprobe ) cprobe = 4;
+	if ( 4 < cfan ) cfan = 4;
+	if ( 4 < c5v0 ) c5v0 = 4;
+	if ( 4 < c3v3 ) c3v3 = 4;
+	if ( 8 < cvadj ) cvadj = 8;
+	if ( cportMax < cport ) cport = cportMax;
+
+	cnode = 0;
+	memset(rgpod, 0, sizeof(rgpod));
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/");
+	AddNode(ntypeFile, nattrPdid, 0, fFalse, "/pdid");
+	AddNode(ntypeFile, nattrFirmwareVersion, 0, fFalse, "/firmware_version");
+	AddNode(ntypeFile, nattrConfigurationVersion, 0, fFalse, "/configuration_version");
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/platform");
+	AddNode(ntypeFile, nattrPlatformConfig, 0, fFalse, "/platform/config");
+	AddNode(ntypeFile, nattrEnforce5v0, 0, fTrue, "/platform/enforce5v0");
+	AddNode(ntypeFile, nattrEnforce3v3, 0, fTrue, "/platform/enforce3v3");
+	AddNode(ntypeFile, nattrEnforceVio, 0, fTrue, "/platform/enforcevio");
+	AddNode(ntypeFile, nattrCheckCrc, 0, fTrue, "/platform/checkcrc");
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/vadj");
+	for ( i = 0; i < cvadj; i++ ) {
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/vadj/%c", 'A' + i);
+		AddNode(ntypeFile, nattrVadjVoltage, i, fFalse, "/vadj/%c/voltage", 'A' + i);
+		AddNode(ntypeFile, nattrVadjEnabled, i, fFalse, "/vadj/%c/enabled", 'A' + i);
+		AddNode(ntypeFile, nattrVadjPowerGood, i, fFalse, "/vadj/%c/power_good", 'A' + i);
+		AddNode(ntypeFile, nattrVadjOverride, i, fTrue, "/vadj/%c/override", 'A' + i);
+		AddNode(ntypeFile, nattrVadjEnable, i, fTrue, "/vadj/%c/enable", 'A' + i);
+		AddNode(ntypeFile, nattrVadjOverrideVoltage, i, fTrue, "/vadj/%c/override_voltage", 'A' + i);
+		AddNode(ntypeFile, nattrVadjCurrentAllowed, i, fFalse, "/vadj/%c/current_allowed", 'A' + i);
+		AddNode(ntypeFile, nattrVadjCurrentRequested, i, fFalse, "/vadj/%c/current_requested", 'A' + i);
+	}
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/5v0");
+	for ( i = 0; i < c5v0; i++ ) {
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/5v0/%c", 'A' + i);
+		AddNode(ntypeFile, nattr5v0CurrentAllowed, i, fFalse, "/5v0/%c/current_allowed", 'A' + i);
+		AddNode(ntypeFile, nattr5v0CurrentRequested, i, fFalse, "/5v0/%c/current_requested", 'A' + i);
+	}
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/3v3");
+	for ( i = 0; i < c3v3; i++ ) {
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/3v3/%c", 'A' + i);
+		AddNode(ntypeFile, nattr3v3CurrentAllowed, i, fFalse, "/3v3/%c/current_allowed", 'A' + i);
+		AddNode(ntypeFile, nattr3v3CurrentRequested, i, fFalse, "/3v3/%c/current_requested", 'A' + i);
+	}
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/temp");
+	for ( i = 0; i < cprobe; i++ ) {
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/temp/%d", i + 1);
+		AddNode(ntypeFile, nattrTemperature, i, fFalse, "/temp/%d/temperature", i + 1);
+	}
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/fan");
+	for ( i = 0; i < cfan; i++ ) {
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/fan/%d", i + 1);
+		AddNode(ntypeFile, nattrFanRpm, i, fFalse, "/fan/%d/rpm", i + 1);
+		AddNode(ntypeFile, nattrFanEnable, i, fTrue, "/fan/%d/enable", i + 1);
+		AddNode(ntypeFile, nattrFanSpeed, i, fTrue, "/fan/%d/speed", i + 1);
+		AddNode(ntypeFile, nattrFanProbe, i, fTrue, "/fan/%d/probe", i + 1);
+	}
+
+	AddNode(ntypeDir, nattrNone, 0, fFalse, "/port");
+	for ( i = 0; i < cport; i++ ) {
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/port/%c", 'A' + i);
+		AddNode(ntypeFile, nattrPortI2cAddress, i, fFalse, "/port/%c/i2c_address", 'A' + i);
+		AddNode(ntypeFile, nattrPortType, i, fFalse, "/port/%c/type", 'A' + i);
+		AddNode(ntypeFile, nattrPortStatus, i, fFalse, "/port/%c/status", 'A' + i);
+		AddNode(ntypeFile, nattrPortPresent, i, fFalse, "/port/%c/present", 'A' + i);
+		AddNode(ntypeFile, nattrPortPdid, i, fFalse, "/port/%c/pdid", 'A' + i);
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/port/%c/dna", 'A' + i);
+		AddNode(ntypeFile, nattrDnaManufacturer, i, fFalse, "/port/%c/dna/manufacturer", 'A' + i);
+		AddNode(ntypeFile, nattrDnaProduct, i, fFalse, "/port/%c/dna/product", 'A' + i);
+		AddNode(ntypeFile, nattrDnaModel, i, fFalse, "/port/%c/dna/model", 'A' + i);
+		AddNode(ntypeFile, nattrDnaVersion, i, fFalse, "/port/%c/dna/version", 'A' + i);
+		AddNode(ntypeFile, nattrDnaSerial, i, fFalse, "/port/%c/dna/serial", 'A' + i);
+		AddNode(ntypeDir, nattrNone, i, fFalse, "/port/%c/cal", 'A' + i);
+		AddNode(ntypeFile, nattrCalFactory, i, fFalse, "/port/%c/cal/factory.bin", 'A' + i);
+		AddNode(ntypeFile, nattrCalUser, i, fFalse, "/port/%c/cal/user.bin", 'A' + i);
+	}
+
+	return fTrue;
+}
+
+/* ------------------------------------------------------------ */
+/***    AddNode
+**
+**  Parameters:
+**      ntype           - ntypeDir or ntypeFile
+**      nattr           - what the file represents
+**      ival            - index of the supply, probe, fan or port
+**      fWritable       - fTrue if the file may be written
+**      szFmt           - printf style format of the path
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function appends a node to the file tree.
+*/
+static void
+AddNode(BYTE ntype, BYTE nattr, BYTE ival, BOOL fWritable, const char* szFmt, ...) {
+
+	va_list	args;
+
+	if ( cnodeMax <= cnode ) {
+		return;
+	}
+
+	va_start(args, szFmt);
+	vsnprintf(rgnode[cnode].szPath, cchNodePathMax, szFmt, args);
+	va_end(args);
+
+	rgnode[cnode].ntype = ntype;
+	rgnode[cnode].nattr = nattr;
+	rgnode[cnode].ival = ival;
+	rgnode[cnode].fWritable = fWritable;
+	cnode++;
+}
+
+/* ------------------------------------------------------------ */
+/***    PnodeFind
+**
+**  Parameters:
+**      szPath          - path relative to the mount point
+**
+**  Return Value:
+**      pointer to the node, NULL if there is no such node
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function looks up a node of the file tree by path.
+*/
+static DPMFS_NODE*
+PnodeFind(const char* szPath) {
+
+	DWORD	inode;
+
+	for ( inode = 0; inode < cnode; inode++ ) {
+		if ( 0 == strcmp(rgnode[inode].szPath, szPath) ) {
+			return &rgnode[inode];
+		}
+	}
+
+	return NULL;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmFsGetattr
+**
+**  Parameters:
+**      szPath          - path relative to the mount point
+**      pst             - pointer to the structure to receive attributes
+**      pfi             - open file information (unused)
+**
+**  Return Value:
+**      0 for success, negative errno otherwise
+**
+**  Errors:
+**      -ENOENT if there is no such node
+**
+**  Description:
+**      This function returns the attributes of a file or directory. The
+**      size of text files is reported as zero, as it is for procfs and
+**      sysfs; they're opened with direct I/O so reads aren't limited by
+**      the reported size. Calibration files have the size of the record
+**      of the pod attached to the port, zero if it has none.
+*/
+static int
+DpmFsGetattr(const char* szPath, struct stat* pst, struct fuse_file_info* pfi) {
+
+	DPMFS_NODE*	pnode;
+	DPMFS_POD*	ppod;
+
+	(void)pfi;
+
+	pnode = PnodeFind(szPath);
+	if ( NULL == pnode ) {
+		return -ENOENT;
+	}
+
+	memset(pst, 0, sizeof(struct stat));
+	if ( ntypeDir == pnode->ntype ) {
+		pst->st_mode = S_IFDIR | 0555;
+		pst->st_nlink = 2;
+	}
+	else {
+		pst->st_mode = S_IFREG | (( pnode->fWritable ) ? 0644 : 0444);
+		pst->st_nlink = 1;
+		if (( nattrCalFactory == pnode->nattr ) || ( nattrCalUser == pnode->nattr )) {
+			pthread_mutex_lock(&mtxPod);
+			ppod = &rgpod[pnode->ival];
+			if (( FPodRefresh(pnode->ival, ppod) ) && ( ppod->fCal )) {
+				pst->st_size = ppod->cbCal;
+			}
+			pthread_mutex_unlock(&mtxPod);
+		}
+	}
+
+	return 0;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmFsReaddir
+**
+**  Parameters:
+**      szPath          - path of the directory relative to the mount point
+**      pvBuf           - buffer passed to pfnFill
+**      pfnFill         - function used to return each entry
+**      off             - offset (unused, the whole directory is returned)
+**      pfi             - open file information (unused)
+**      flags           - readdir flags (unused)
+**
+**  Return Value:
+**      0 for success, negative errno otherwise
+**
+**  Errors:
+**      -ENOENT if there is no such node, -ENOTDIR if it isn't a directory
+**
+**  Description:
+**      This function lists the children of a directory.
+*/
+static int
+DpmFsReaddir(const char* szPath, void* pvBuf, fuse_fill_dir_t pfnFill, off_t off, struct fuse_file_info* pfi, enum fuse_readdir_flags flags) {
+
+	DPMFS_NODE*	pnode;
+	DWORD		inode;
+	size_t		cchDir;
+	const char*	szChild;
+
+	(void)off;
+	(void)pfi;
+	(void)flags;
+
+	pnode = PnodeFind(szPath);
+	if ( NULL == pnode ) {
+		return -ENOENT;
+	}
+	if ( ntypeDir != pnode->ntype ) {
+		return -ENOTDIR;
+	}
+
+	pfnFill(pvBuf, ".", NULL, 0, 0);
+	pfnFill(pvBuf, "..", NULL, 0, 0);
+
+	/* The root is the only directory whose path ends with a separator.
+	*/
+	cchDir = strlen(szPath);
+	if ( '/' == szPath[cchDir - 1] ) {
+		cchDir--;
+	}
+
+	for ( inode = 0; inode < cnode; inode++ ) {
+		if (( 0 != strncmp(rgnode[inode].szPath, szPath, cchDir) ) ||
+			( '/' != rgnode[inode].szPath[cchDir] )) {
+			continue;
+		}
+
+		szChild = &rgnode[inode].szPath[cchDir + 1];
+		if (( '\0' != *szChild ) && ( NULL == strchr(szChild, '/') )) {
+			pfnFill(pvBuf, szChild, NULL, 0, 0);
+		}
+	}
+
+	return 0;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmFsOpen
+**
+**  Parameters:
+**      szPath          - path relative to the mount point
+**      pfi             - open file information
+**
+**  Return Value:
+**      0 for success, negative errno otherwise
+**
+**  Errors:
+**      -ENOENT if there is no such node, -EISDIR for directories and
+**      -EACCES when opening a read-only file for writing
+**
+**  Description:
+**      This function opens a file. Files are always opened with direct
+**      I/O so that the kernel doesn't cache their contents.
+*/
+static int
+DpmFsOpen(const char* szPath, struct fuse_file_info* pfi) {
+
+	DPMFS_NODE*	pnode;
+
+	pnode = PnodeFind(szPath);
+	if ( NULL == pnode ) {
+		return -ENOENT;
+	}
+	if ( ntypeDir == pnode->ntype ) {
+		return -EISDIR;
+	}
+	if (( O_RDONLY != (pfi->flags & O_ACCMODE) ) && ( ! pnode->fWritable )) {
+		return -EACCES;
+	}
+
+	pfi->direct_io = 1;
+
+	return 0;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmFsRead
+**
+**  Parameters:
+**      szPath          - path relative to the mount point
+**      pbBuf           - buffer to receive data
+**      cb              - size of the buffer
+**      off             - offset in the file of the first byte to return
+**      pfi             - open file information (unused)
+**
+**  Return Value:
+**      number of bytes read, negative errno otherwise
+**
+**  Errors:
+**      -ENOENT if there is no such node, -EIO if the bus transaction
+**      fails or the data isn't available
+**
+**  Description:
+**      This function renders the current contents of a file and returns
+**      the requested part.
+*/
+static int
+DpmFsRead(const char* szPath, char* pbBuf, size_t cb, off_t off, struct fuse_file_info* pfi) {
+
+	DPMFS_NODE*	pnode;
+	char		rgch[cchRenderMax];
+	size_t		cch;
+
+	(void)pfi;
+
+	pnode = PnodeFind(szPath);
+	if ( NULL == pnode ) {
+		return -ENOENT;
+	}
+	if ( ntypeDir == pnode->ntype ) {
+		return -EISDIR;
+	}
+
+	if ( ! FRenderNode(pnode, rgch, &cch) ) {
+		return -EIO;
+	}
+
+	if (( 0 > off ) || ( (size_t)off >= cch )) {
+		return 0;
+	}
+	if ( cb > cch - off ) {
+		cb = cch - off;
+	}
+	memcpy(pbBuf, &rgch[off], cb);
+
+	return cb;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmFsWrite
+**
+**  Parameters:
+**      szPath          - path relative to the mount point
+**      pbBuf           - data written by the caller
+**      cb              - number of bytes written
+**      off             - offset in the file (must be 0)
+**      pfi             - open file information (unused)
+**
+**  Return Value:
+**      number of bytes written, negative errno otherwise
+**
+**  Errors:
+**      -EINVAL if the value can't be parsed, -EIO if the register can't
+**      be written
+**
+**  Description:
+**      This function parses the value written to a file and applies it
+**      to the corresponding Platform MCU configuration register. The
+**      whole value must be written with a single call.
+*/
+static int
+DpmFsWrite(const char* szPath, const char* pbBuf, size_t cb, off_t off, struct fuse_file_info* pfi) {
+
+	DPMFS_NODE*	pnode;
+	char		szVal[cchWriteMax + 1];
+	size_t		cch;
+	int			err;
+
+	(void)pfi;
+
+	pnode = PnodeFind(szPath);
+	if ( NULL == pnode ) {
+		return -ENOENT;
+	}
+	if ( ! pnode->fWritable ) {
+		return -EACCES;
+	}
+	if (( 0 != off ) || ( cchWriteMax < cb )) {
+		return -EINVAL;
+	}
+
+	/* Strip the trailing newline that echo appends, along with any other
+	** trailing white space.
+	*/
+	memcpy(szVal, pbBuf, cb);
+	cch = cb;
+	while (( 0 < cch ) && (( '\n' == szVal[cch - 1] ) || ( ' ' == szVal[cch - 1] ) ||
+						   ( '\r' == szVal[cch - 1] ) || ( '\t' == szVal[cch - 1] ))) {
+		cch--;
+	}
+	szVal[cch] = '\0';
+
+	err = ErrWriteNode(pnode, szVal);
+	if ( 0 != err ) {
+		return err;
+	}
+
+	return cb;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmFsTruncate
+**
+**  Parameters:
+**      szPath          - path relative to the mount point
+**      off             - new size (ignored)
+**      pfi             - open file information (unused)
+**
+**  Return Value:
+**      0 for success, negative errno otherwise
+**
+**  Errors:
+**      -ENOENT if there is no such node, -EACCES if it isn't writable
+**
+**  Description:
+**      Shell redirection truncates a file before writing it. Register
+**      files have no storage to truncate, so this is a no-op for the
+**      writable files.
+*/
+static int
+DpmFsTruncate(const char* szPath, off_t off, struct fuse_file_info* pfi) {
+
+	DPMFS_NODE*	pnode;
+
+	(void)off;
+	(void)pfi;
+
+	pnode = PnodeFind(szPath);
+	if ( NULL == pnode ) {
+		return -ENOENT;
+	}
+	if ( ! pnode->fWritable ) {
+		return -EACCES;
+	}
+
+	return 0;
+}
+
+/* ------------------------------------------------------------ */
+/***    FRenderNode
+**
+**  Parameters:
+**      pnode           - node to render
+**      pch             - buffer of cchRenderMax bytes to receive contents
+**      pcch            - pointer to variable to receive the size
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      Fails if a bus transaction fails or if the pod doesn't provide
+**      the requested data.
+**
+**  Description:
+**      This function produces the contents of a file. Text files hold a
+**      single value followed by a newline.
+*/
+static BOOL
+FRenderNode(DPMFS_NODE* pnode, char* pch, size_t* pcch) {
+
+	BYTE					ival;
+	WORD					w;
+	DWORD					dw;
+	BYTE					b;
+	PLATFORM_CONFIG			platcfg;
+	VADJ_STATUS				vadjsts;
+	VADJ_OVERRIDE			vadjow;
+	TEMPERATURE_ATTRIBUTES	tattr;
+	FAN_CONFIGURATION		fcfg;
+	PmcuPortStatus			portsts;
+	DPMFS_POD*				ppod;
+	const BYTE*				pbCal;
+	BYTE					iszDna;
+	int						cch;
+
+	ival = pnode->ival;
+	cch = -1;
+
+	switch ( pnode->nattr ) {
+		case nattrPdid:
+			if ( DpmSessionPmcuRead(&sessFs, regaddrPDID, (BYTE*)&dw, 4, NULL) ) {
+				cch = snprintf(pch, cchRenderMax, "0x%08X\n", (unsigned int)dw);
+			}
+			break;
+
+		case nattrFirmwareVersion:
+		case nattrConfigurationVersion:
+			if ( FReadWord(( nattrFirmwareVersion == pnode->nattr ) ? regaddrFirmwareVersion : regaddrConfigurationVersion, &w) ) {
+				cch = snprintf(pch, cchRenderMax, "%d.%d\n", w >> 8, w & 0xFF);
+			}
+			break;
+
+		case nattrPlatformConfig:
+		case nattrEnforce5v0:
+		case nattrEnforce3v3:
+		case nattrEnforceVio:
+		case nattrCheckCrc:
+			if ( ! FReadWord(regaddrPlatformConfig, &platcfg.fsConfig) ) {
+				break;
+			}
+			switch ( pnode->nattr ) {
+				case nattrPlatformConfig:
+					cch = snprintf(pch, cchRenderMax, "0x%04X\n", platcfg.fsConfig);
+					break;
+				case nattrEnforce5v0:
+					cch = snprintf(pch, cchRenderMax, "%d\n", platcfg.fEnforce5v0CurLimit);
+					break;
+				case nattrEnforce3v3:
+					cch = snprintf(pch, cchRenderMax, "%d\n", platcfg.fEnforce3v3CurLimit);
+					break;
+				case nattrEnforceVio:
+					cch = snprintf(pch, cchRenderMax, "%d\n", platcfg.fEnforceVioCurLimit);
+					break;
+				default:
+					cch = snprintf(pch, cchRenderMax, "%d\n", platcfg.fPerformCrcCheck);
+					break;
+			}
+			break;
+
+		case nattrVadjVoltage:
+			if ( FReadWord(regaddrVadjAVoltage + (offsetVadjReg*ival), &w) ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", w * 10);
+			}
+			break;
+
+		case nattrVadjEnabled:
+		case nattrVadjPowerGood:
+			if ( DpmSessionPmcuRead(&sessFs, regaddrVadjStatus, (BYTE*)&vadjsts, 2, NULL) ) {
+				b = ( nattrVadjEnabled == pnode->nattr ) ? vadjsts.fsEn : vadjsts.fsPgood;
+				cch = snprintf(pch, cchRenderMax, "%d\n", (b >> ival) & 1);
+			}
+			break;
+
+		case nattrVadjOverride:
+		case nattrVadjEnable:
+		case nattrVadjOverrideVoltage:
+			if ( ! FReadWord(regaddrVadjAOverride + (offsetVadjReg*ival), &vadjow.fs) ) {
+				break;
+			}
+			if ( nattrVadjOverride == pnode->nattr ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", vadjow.fOverride);
+			}
+			else if ( nattrVadjEnable == pnode->nattr ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", vadjow.fEnable);
+			}
+			else {
+				cch = snprintf(pch, cchRenderMax, "%d\n", vadjow.vltgSet * 10);
+			}
+			break;
+
+		case nattrVadjCurrentAllowed:
+		case nattrVadjCurrentRequested:
+			if ( FReadWord((( nattrVadjCurrentAllowed == pnode->nattr ) ? regaddrVadjACurrentAllowed : regaddrVadjACurrentRequested) + (offsetVadjReg*ival), &w) ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", w);
+			}
+			break;
+
+		case nattr5v0CurrentAllowed:
+		case nattr5v0CurrentRequested:
+			if ( FReadWord((( nattr5v0CurrentAllowed == pnode->nattr ) ? regaddr5v0ACurrentAllowed : regaddr5v0ACurrentRequested) + (offset5v0Reg*ival), &w) ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", w);
+			}
+			break;
+
+		case nattr3v3CurrentAllowed:
+		case nattr3v3CurrentRequested:
+			if ( FReadWord((( nattr3v3CurrentAllowed == pnode->nattr ) ? regaddr3v3ACurrentAllowed : regaddr3v3ACurrentRequested) + (offset3v3Reg*ival), &w) ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", w);
+			}
+			break;
+
+		case nattrTemperature:
+			if (( ! DpmSessionPmcuRead(&sessFs, regaddrTemp1Attributes + (offsetTemperatureReg*ival), &tattr.fs, 1, NULL) ) ||
+				( ! FReadWord(regaddrTemp1 + (offsetTemperatureReg*ival), &w) )) {
+				break;
+			}
+			switch ( tattr.tformat ) {
+				case tformatDegCDecimal:
+				case tformatDegFDecimal:
+					cch = snprintf(pch, cchRenderMax, "%hd\n", (SHORT)w);
+					break;
+				default:
+					cch = snprintf(pch, cchRenderMax, "%.2f\n", (SHORT)w / 256.0);
+					break;
+			}
+			break;
+
+		case nattrFanRpm:
+			if ( FReadWord(regaddrFan1Rpm + (offsetFanReg*ival), &w) ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", w);
+			}
+			break;
+
+		case nattrFanEnable:
+		case nattrFanSpeed:
+		case nattrFanProbe:
+			if ( ! DpmSessionPmcuRead(&sessFs, regaddrFan1Config + (offsetFanReg*ival), &fcfg.fs, 1, NULL) ) {
+				break;
+			}
+			if ( nattrFanEnable == pnode->nattr ) {
+				cch = snprintf(pch, cchRenderMax, "%d\n", fcfg.fEnable);
+			}
+			else if ( nattrFanSpeed == pnode->nattr ) {
+				cch = snprintf(pch, cchRenderMax, "%s\n", rgszFanSpeed[fcfg.fspeed]);
+			}
+			else if ( fancfgTempProbe4 >= fcfg.tempsrc ) {
+				cch = snprintf(pch, cchRenderMax, "%s\n", rgszFanProbe[fcfg.tempsrc]);
+			}
+			break;
+
+		case nattrPortI2cAddress:
+			if ( DpmSessionPmcuRead(&sessFs, regaddrPortAI2cAddress + (offsetPortReg*ival), &b, 1, NULL) ) {
+				cch = snprintf(pch, cchRenderMax, "0x%02X\n", b);
+			}
+			break;
+
+		case nattrPortType:
+			if ( DpmSessionPmcuRead(&sessFs, regaddrPortAType + (offsetPortReg*ival), &b, 1, NULL) ) {
+				switch ( b ) {
+					case ptypeNone:
+						cch = snprintf(pch, cchRenderMax, "none\n");
+						break;
+					case ptypeSyzygyStd:
+						cch = snprintf(pch, cchRenderMax, "syzygy_std\n");
+						break;
+					case ptypeSyzygyTxr2:
+						cch = snprintf(pch, cchRenderMax, "syzygy_txr2\n");
+						break;
+					case ptypeSyzygyTxr4:
+						cch = snprintf(pch, cchRenderMax, "syzygy_txr4\n");
+						break;
+					default:
+						cch = snprintf(pch, cchRenderMax, "0x%02X\n", b);
+						break;
+				}
+			}
+			break;
+
+		case nattrPortStatus:
+		case nattrPortPresent:
+			if ( DpmSessionPmcuRead(&sessFs, regaddrPortAStatus + (offsetPortReg*ival), &portsts.fsStatus, 1, NULL) ) {
+				if ( nattrPortStatus == pnode->nattr ) {
+					cch = snprintf(pch, cchRenderMax, "0x%02X\n", portsts.fsStatus);
+				}
+				else {
+					cch = snprintf(pch, cchRenderMax, "%d\n", portsts.fPresent);
+				}
+			}
+			break;
+
+		case nattrPortPdid:
+		case nattrDnaManufacturer:
+		case nattrDnaProduct:
+		case nattrDnaModel:
+		case nattrDnaVersion:
+		case nattrDnaSerial:
+		case nattrCalFactory:
+		case nattrCalUser:
+			pthread_mutex_lock(&mtxPod);
+			ppod = &rgpod[ival];
+			if ( ! FPodRefresh(ival, ppod) ) {
+				pthread_mutex_unlock(&mtxPod);
+				break;
+			}
+			if ( nattrPortPdid == pnode->nattr ) {
+				if ( ppod->fPdid ) {
+					cch = snprintf(pch, cchRenderMax, "0x%08X\n", (unsigned int)ppod->pdid);
+				}
+			}
+			else if (( nattrCalFactory == pnode->nattr ) || ( nattrCalUser == pnode->nattr )) {
+				if ( ppod->fCal ) {
+					pbCal = ( nattrCalFactory == pnode->nattr ) ? ppod->rgbCalFactory : ppod->rgbCalUser;
+					memcpy(pch, pbCal, ppod->cbCal);
+					cch = ppod->cbCal;
+				}
+			}
+			else if ( ppod->fDna ) {
+				iszDna = pnode->nattr - nattrDnaManufacturer;
+				cch = snprintf(pch, cchRenderMax, "%s\n", ppod->rgszDna[iszDna]);
+			}
+			pthread_mutex_unlock(&mtxPod);
+			break;
+
+		default:
+			break;
+	}
+
+	if (( 0 > cch ) || ( cchRenderMax < cch )) {
+		return fFalse;
+	}
+
+	*pcch = cch;
+
+	return fTrue;
+}
+
+/* ------------------------------------------------------------ */
+/***    ErrWriteNode
+**
+**  Parameters:
+**      pnode           - node being written
+**      szVal           - value written, without trailing white space
+**
+**  Return Value:
+**      0 for success, negative errno otherwise
+**
+**  Errors:
+**      -EINVAL if the value can't be parsed, -EIO if the set function
+**      fails
+**
+**  Description:
+**      This function applies a value written to a file by calling the
+**      dpmutil set function for the corresponding register. The bus is
+**      locked for the duration of the call so that no cached read can
+**      be interleaved with the read-modify-write performed by the set
+**      function.
+*/
+static int
+ErrWriteNode(DPMFS_NODE* pnode, const char* szVal) {
+
+	dpmutildevInfo_t	devinfo;
+	BOOL				fVal;
+	BYTE				bVal;
+	unsigned int		vltg;
+	char				chEnd;
+	BOOL				fRet;
+
+	fVal = fFalse;
+	bVal = 0;
+	vltg = 0;
+
+	/* Parse the value before acquiring the bus.
+	*/
+	switch ( pnode->nattr ) {
+		case nattrFanSpeed:
+			if ( ! FParseName(szVal, rgszFanSpeed, 4, &bVal) ) {
+				return -EINVAL;
+			}
+			break;
+		case nattrFanProbe:
+			if ( ! FParseName(szVal, rgszFanProbe, 5, &bVal) ) {
+				return -EINVAL;
+			}
+			break;
+		case nattrVadjOverrideVoltage:
+			if (( 1 != sscanf(szVal, "%u%c", &vltg, &chEnd) ) || ( 10230 < vltg )) {
+				return -EINVAL;
+			}
+			break;
+		default:
+			if ( ! FParseBool(szVal, &fVal) ) {
+				return -EINVAL;
+			}
+			break;
+	}
+
+	DpmSessionLockBus(&sessFs);
+
+	switch ( pnode->nattr ) {
+		case nattrEnforce5v0:
+			fRet = dpmutilFSetPlatformConfig(&devinfo, fTrue, fVal, fFalse, fFalse, fFalse, fFalse, fFalse, fFalse);
+			break;
+		case nattrEnforce3v3:
+			fRet = dpmutilFSetPlatformConfig(&devinfo, fFalse, fFalse, fTrue, fVal, fFalse, fFalse, fFalse, fFalse);
+			break;
+		case nattrEnforceVio:
+			fRet = dpmutilFSetPlatformConfig(&devinfo, fFalse, fFalse, fFalse, fFalse, fTrue, fVal, fFalse, fFalse);
+			break;
+		case nattrCheckCrc:
+			fRet = dpmutilFSetPlatformConfig(&devinfo, fFalse, fFalse, fFalse, fFalse, fFalse, fFalse, fTrue, fVal);
+			break;
+		case nattrVadjOverride:
+			fRet = dpmutilFSetVioConfig(pnode->ival, fFalse, fFalse, fTrue, fVal, fFalse, 0);
+			break;
+		case nattrVadjEnable:
+			fRet = dpmutilFSetVioConfig(pnode->ival, fTrue, fVal, fFalse, fFalse, fFalse, 0);
+			break;
+		case nattrVadjOverrideVoltage:
+			fRet = dpmutilFSetVioConfig(pnode->ival, fFalse, fFalse, fFalse, fFalse, fTrue, vltg);
+			break;
+		case nattrFanEnable:
+			fRet = dpmutilFSetFanConfig(pnode->ival, fTrue, fVal, fFalse, 0, fFalse, 0);
+			break;
+		case nattrFanSpeed:
+			fRet = dpmutilFSetFanConfig(pnode->ival, fFalse, fFalse, fTrue, bVal, fFalse, 0);
+			break;
+		case nattrFanProbe:
+			fRet = dpmutilFSetFanConfig(pnode->ival, fFalse, fFalse, fFalse, 0, fTrue, bVal);
+			break;
+		default:
+			fRet = fFalse;
+			break;
+	}
+
+	DpmSessionUnlockBus(&sessFs, fTrue);
+
+	return ( fRet ) ? 0 : -EIO;
+}
+
+/* ------------------------------------------------------------ */
+/***    FPodRefresh
+**
+**  Parameters:
+**      iport           - index of the SmartVIO port
+**      ppod            - cached contents of the pod attached to the port
+**
+**  Return Value:
+**      fTrue if a SYZYGY pod is attached to the port, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function checks whether the pod attached to a port may have
+**      changed and, if so, reads its DNA, PDID and calibration. The port
+**      status and address are read through the session cache, so the
+**      check itself is served from the cache for most reads. Sections
+**      that the pod doesn't provide are flagged as missing. If one of
+**      the reads fails the contents are read again on the next call.
+**      The caller must hold mtxPod.
+*/
+static BOOL
+FPodRefresh(BYTE iport, DPMFS_POD* ppod) {
+
+	BYTE			addrI2c;
+	BYTE			ptype;
+	PmcuPortStatus	portsts;
+	SzgDnaHeader	hdr;
+	BYTE			rgcch[5];
+	WORD			addrRead;
+	WORD			addrCalFact;
+	WORD			addrCalUser;
+	BYTE			idCal;
+	BYTE			isz;
+	BOOL			fReadOk;
+
+	if (( ! DpmSessionPmcuRead(&sessFs, regaddrPortAI2cAddress + (offsetPortReg*iport), &addrI2c, 1, NULL) ) ||
+		( ! DpmSessionPmcuRead(&sessFs, regaddrPortAType + (offsetPortReg*iport), &ptype, 1, NULL) ) ||
+		( ! DpmSessionPmcuRead(&sessFs, regaddrPortAStatus + (offsetPortReg*iport), &portsts.fsStatus, 1, NULL) )) {
+		return fFalse;
+	}
+
+	if (( ppod->fValid ) && ( ppod->addrI2c == addrI2c ) && ( ppod->fsStatus == portsts.fsStatus )) {
+		return fTrue;
+	}
+
+	memset(ppod, 0, sizeof(DPMFS_POD));
+
+	if (( ! portsts.fPresent ) || ( ! IsSyzygyPort(ptype) )) {
+		return fFalse;
+	}
+
+	ppod->addrI2c = addrI2c;
+	ppod->fsStatus = portsts.fsStatus;
+
+	/* Read the DNA header and strings. A pod whose DNA is missing or
+	** invalid is remembered as such, but a failed bus transaction
+	** leaves the cached contents invalid so that they are read again on
+	** the next access.
+	*/
+	fReadOk = DpmSessionSyzygyRead(&sessFs, addrI2c, addrDnaStart, (BYTE*)&hdr, cbSyzygyDnaHeader, NULL);
+	if (( fReadOk ) && ( 0 == SyzygyComputeCRC((BYTE*)&hdr, cbSyzygyDnaHeader) )) {
+		rgcch[0] = hdr.cbManufacturerName;
+		rgcch[1] = hdr.cbProductName;
+		rgcch[2] = hdr.cbProductModel;
+		rgcch[3] = hdr.cbProductVersion;
+		rgcch[4] = hdr.cbSerialNumber;
+
+		addrRead = addrDnaStart + hdr.cbDnaHeader;
+		for ( isz = 0; ( fReadOk ) && ( isz < 5 ); isz++ ) {
+			fReadOk = DpmSessionSyzygyRead(&sessFs, addrI2c, addrRead, (BYTE*)ppod->rgszDna[isz], rgcch[isz], NULL);
+			ppod->rgszDna[isz][rgcch[isz]] = '\0';
+			addrRead += rgcch[isz];
+		}
+		ppod->fDna = fReadOk;
+
+		/* Only Digilent pods have a PDID and only Zmods that are known to
+		** store calibration in their DNA have calibration records, whose
+		** location and size depend on the kind of Zmod.
+		*/
+		if (( ppod->fDna ) && ( 0 == strcmp(ppod->rgszDna[0], "Digilent") )) {
+			fReadOk = DpmSessionSyzygyRead(&sessFs, addrI2c, addrPdid, (BYTE*)&ppod->pdid, 4, NULL);
+			ppod->fPdid = fReadOk;
+		}
+		if ( ppod->fPdid ) {
+			switch ( ProductFromPdid(ppod->pdid) ) {
+				case prodZmodADC:
+					/* prodZmodDigitizer is the same product, told apart
+					** by the id of its factory calibration record.
+					*/
+					fReadOk = DpmSessionSyzygyRead(&sessFs, addrI2c, addrDigitizerFactCalStart, &idCal, 1, NULL);
+					if ( ! fReadOk ) {
+						break;
+					}
+					if ( idDigitizerCal == idCal ) {
+						addrCalFact = addrDigitizerFactCalStart;
+						addrCalUser = addrDigitizerUserCalStart;
+						ppod->cbCal = sizeof(ZMOD_DIGITIZER_CAL);
+					}
+					else {
+						addrCalFact = addrAdcFactCalStart;
+						addrCalUser = addrAdcUserCalStart;
+						ppod->cbCal = sizeof(ZMOD_ADC_CAL);
+					}
+					break;
+				case prodZmodDAC:
+					addrCalFact = addrDacFactCalStart;
+					addrCalUser = addrDacUserCalStart;
+					ppod->cbCal = sizeof(ZMOD_DAC_CAL);
+					break;
+				default:
+					break;
+			}
+			if ( 0 < ppod->cbCal ) {
+				fReadOk = ( DpmSessionSyzygyRead(&sessFs, addrI2c, addrCalFact, ppod->rgbCalFactory, ppod->cbCal, NULL) ) &&
+						  ( DpmSessionSyzygyRead(&sessFs, addrI2c, addrCalUser, ppod->rgbCalUser, ppod->cbCal, NULL) );
+				ppod->fCal = fReadOk;
+			}
+		}
+	}
+
+	ppod->fValid = fReadOk;
+
+	return fTrue;
+}
+
+/* ------------------------------------------------------------ */
+/***    FParseBool
+**
+**  Parameters:
+**      szVal           - string to parse
+**      pfVal           - pointer to variable to receive the value
+**
+**  Return Value:
+**      fTrue for success, fFalse if the string isn't a boolean
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function accepts 1/0, y/n, yes/no and on/off.
+*/
+static BOOL
+FParseBool(const char* szVal, BOOL* pfVal) {
+
+	if (( 0 == strcmp(szVal, "1") ) || ( 0 == strcasecmp(szVal, "y") ) ||
+		( 0 == strcasecmp(szVal, "yes") ) || ( 0 == strcasecmp(szVal, "on") )) {
+		*pfVal = fTrue;
+		return fTrue;
+	}
+
+	if (( 0 == strcmp(szVal, "0") ) || ( 0 == strcasecmp(szVal, "n") ) ||
+		( 0 == strcasecmp(szVal, "no") ) || ( 0 == strcasecmp(szVal, "off") )) {
+		*pfVal = fFalse;
+		return fTrue;
+	}
+
+	return fFalse;
+}
+
+/* ------------------------------------------------------------ */
+/***    FParseName
+**
+**  Parameters:
+**      szVal           - string to parse
+**      rgsz            - names of the values, in order
+**      cname           - number of names
+**      pival           - pointer to variable to receive the value
+**
+**  Return Value:
+**      fTrue for success, fFalse if the string isn't a valid value
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function accepts either the name of a value or its index.
+*/
+static BOOL
+FParseName(const char* szVal, const char* rgsz[], BYTE cname, BYTE* pival) {
+
+	BYTE	iname;
+
+	for ( iname = 0; iname < cname; iname++ ) {
+		if ( 0 == strcasecmp(szVal, rgsz[iname]) ) {
+			*pival = iname;
+			return fTrue;
+		}
+	}
+
+	if (( 1 == strlen(szVal) ) && ( '0' <= szVal[0] ) && ( '0' + cname > szVal[0] )) {
+		*pival = szVal[0] - '0';
+		return fTrue;
+	}
+
+	return fFalse;
+}
+
+/* ------------------------------------------------------------ */
+/***    FReadWord
+**
+**  Parameters:
+**      addr            - address of a 16-bit Platform MCU register
+**      pw              - pointer to variable to receive the value
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function reads a 16-bit register through the session cache.
+*/
+static BOOL
+FReadWord(WORD addr, WORD* pw) {
+
+	return DpmSessionPmcuRead(&sessFs, addr, (BYTE*)pw, 2, NULL);
+}
+
+#endif
@@ -0,0 +1,41 @@
+/************************************************************************/
+/*                                                                      */
+/*  DpmFs.h - Platform MCU / SYZYGY pod filesystem view declarations    */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file contains the declarations for a FUSE filesystem    */
+/*  that exposes the Platform MCU registers and the DNA and calibration */
+/*  of attached SYZYGY pods as a tree of files, so that tools that can  */
+/*  only read and write files can monitor and configure the board.      */
+/*                                                                      */
+/*  The filesystem is only built when DPMUTIL_FUSE is defined.          */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef DPMFS_H_
+#define DPMFS_H_
+
+#include "stdtypes.h"
+
+#if defined(__linux__) && defined(DPMUTIL_FUSE)
+
+/* ------------------------------------------------------------ */
+/*                  Procedure Declarations                      */
+/* ------------------------------------------------------------ */
+
+BOOL	DpmFsMount(const char* szProg, const char* szMountDir);
+
+#endif
+
+/* ------------------------------------------------------------ */
+
+#endif /* DPMFS_H_ */
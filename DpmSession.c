@@ -0,0 +1,908 @@
+/************************************************************************/
+/*                                                                      */
+/*  DpmSession.c - Thread-safe Platform MCU session implementation      */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This source file contains the implementation of a session object    */
+/*  that serializes access to the shared Platform MCU / SYZYGY I2C bus  */
+/*  between the threads of a process and caches Platform MCU register   */
+/*  reads.                                                              */
+/*                                                                      */
+/*  The cache keeps a byte-wise shadow of the Platform MCU firmware and */
+/*  configuration registers. Each byte remembers when it was fetched    */
+/*  and is considered fresh for as long as the lifetime assigned to its */
+/*  register class. A read that can't be served from the shadow either  */
+/*  joins a bus transaction that's already fetching a range containing  */
+/*  the requested bytes or issues a transaction of its own.             */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "stdtypes.h"
+#include "I2CHAL.h"
+#include "PlatformMCU.h"
+#include "syzygy.h"
+#include "DpmSession.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Global Variables                                */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static void			InvalidateVolatile(DPM_SESSION* psess);
+static UINT64		UsMonotonic();
+static BOOL			FShadowRange(WORD addr, WORD cb, WORD* pibFirst);
+static BOOL			FShadowFresh(DPM_SESSION* psess, WORD ibFirst, WORD cb, UINT64 usNow);
+static DPM_FLIGHT*	PflightFind(DPM_SESSION* psess, WORD ibFirst, WORD cb);
+static DPM_FLIGHT*	PflightAlloc(DPM_SESSION* psess, WORD ibFirst, WORD cb);
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionOpen
+**
+**  Parameters:
+**      psess           - pointer to the session to initialize
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      Fails if the I2C controller can't be opened.
+**
+**  Description:
+**      This function opens the I2C controller connected to the Platform
+**      MCU / SYZYGY I2C bus and initializes an empty register cache with
+**      the default lifetime for each register class.
+*/
+BOOL
+DpmSessionOpen(DPM_SESSION* psess) {
+
+	memset(psess, 0, sizeof(DPM_SESSION));
+
+	psess->fdI2c = I2CHALOpenI2cController();
+	if ( 0 > psess->fdI2c ) {
+		return fFalse;
+	}
+
+	pthread_mutex_init(&psess->mtxCache, NULL);
+	pthread_mutex_init(&psess->mtxBus, NULL);
+	pthread_cond_init(&psess->condFlight, NULL);
+
+	psess->rgusTtl[regclassStatic] = usTtlStaticDefault;
+	psess->rgusTtl[regclassConfig] = usTtlConfigDefault;
+	psess->rgusTtl[regclassStatus] = usTtlStatusDefault;
+
+	return fTrue;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionClose
+**
+**  Parameters:
+**      psess           - pointer to the session to close
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function closes the I2C controller and releases the
+**      synchronization objects of the session. No other thread may be
+**      using the session when this function is called.
+*/
+void
+DpmSessionClose(DPM_SESSION* psess) {
+
+	if ( 0 <= psess->fdI2c ) {
+		close(psess->fdI2c);
+		psess->fdI2c = -1;
+	}
+
+	pthread_cond_destroy(&psess->condFlight);
+	pthread_mutex_destroy(&psess->mtxBus);
+	pthread_mutex_destroy(&psess->mtxCache);
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionSetTtl
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      regclass        - register class (regclassStatic, regclassConfig
+**                        or regclassStatus)
+**      usTtl           - cache lifetime in microseconds. 0 disables
+**                        caching of the class (concurrent reads are
+**                        still coalesced) and usTtlForever keeps values
+**                        until the cache is invalidated.
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function sets the cache lifetime of a register class.
+*/
+void
+DpmSessionSetTtl(DPM_SESSION* psess, BYTE regclass, UINT64 usTtl) {
+
+	if ( cregclass <= regclass ) {
+		return;
+	}
+
+	pthread_mutex_lock(&psess->mtxCache);
+	psess->rgusTtl[regclass] = usTtl;
+	pthread_mutex_unlock(&psess->mtxCache);
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionInvalidate
+**
+**  Parameters:
+**      psess           - pointer to the session
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function discards every value held by the register cache,
+**      including static registers. It should be called when the
+**      Platform MCU may have been reset or reconfigured by another
+**      process.
+*/
+void
+DpmSessionInvalidate(DPM_SESSION* psess) {
+
+	pthread_mutex_lock(&psess->mtxCache);
+	memset(psess->rgusFetched, 0, sizeof(psess->rgusFetched));
+	psess->genWrite++;
+	pthread_mutex_unlock(&psess->mtxCache);
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionGetStats
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      pstats          - pointer to a structure to receive the counters
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns a snapshot of the cache and bus counters of
+**      the session.
+*/
+void
+DpmSessionGetStats(DPM_SESSION* psess, DPM_SESSION_STATS* pstats) {
+
+	pthread_mutex_lock(&psess->mtxCache);
+	*pstats = psess->stats;
+	pthread_mutex_unlock(&psess->mtxCache);
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionRegClass
+**
+**  Parameters:
+**      regaddr         - Platform MCU register address
+**
+**  Return Value:
+**      class of the register containing the specified address
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function determines the class, and therefore the cache
+**      lifetime, of the Platform MCU register byte at the specified
+**      address.
+*/
+BYTE
+DpmSessionRegClass(WORD regaddr) {
+
+	WORD	off;
+
+	/* PDID and FIRMWARE_VERSION.
+	*/
+	if ( regaddrShadowFwFirst + cbShadowFw > regaddr ) {
+		return regclassStatic;
+	}
+
+	if (( regaddrShadowCfgFirst > regaddr ) ||
+		( regaddrPortHStatus < regaddr )) {
+		return regclassNone;
+	}
+
+	/* CONFIGURATION_VERSION, PLATFORM_CONFIGURATION and the counts.
+	*/
+	if ( regaddrTemp1Attributes > regaddr ) {
+		if (( regaddrPlatformConfig <= regaddr ) &&
+			( regaddrPlatformConfig + cbPlatformConfig > regaddr )) {
+			return regclassConfig;
+		}
+		return regclassStatic;
+	}
+
+	/* TEMPERATURE_n_ATTRIBUTES and TEMPERATURE_n.
+	*/
+	if ( regaddrFan1Capabilities > regaddr ) {
+		off = (regaddr - regaddrTemp1Attributes) % offsetTemperatureReg;
+		return ( 0 == off ) ? regclassStatic : regclassStatus;
+	}
+
+	/* FAN_n_CAPABILITIES, FAN_n_CONFIGURATION and FAN_n_RPM.
+	*/
+	if ( regaddr5v0ACurrentAllowed > regaddr ) {
+		off = (regaddr - regaddrFan1Capabilities) % offsetFanReg;
+		if ( regaddrFan1Config - regaddrFan1Capabilities > off ) {
+			return regclassStatic;
+		}
+		if ( regaddrFan1Rpm - regaddrFan1Capabilities > off ) {
+			return regclassConfig;
+		}
+		return regclassStatus;
+	}
+
+	/* 5V0_n and 3V3_n CURRENT_ALLOWED and CURRENT_REQUESTED.
+	*/
+	if ( regaddrVadjAVoltage > regaddr ) {
+		off = (regaddr - regaddr5v0ACurrentAllowed) % offset5v0Reg;
+		return ( cb5v0ACurrentAllowed > off ) ? regclassStatic : regclassStatus;
+	}
+
+	/* VADJ_n_VOLTAGE, VADJ_n_OVERRIDE, VADJ_n_CURRENT_ALLOWED and
+	** VADJ_n_CURRENT_REQUESTED.
+	*/
+	if ( regaddrVadjStatus > regaddr ) {
+		off = (regaddr - regaddrVadjAVoltage) % offsetVadjReg;
+		if ( regaddrVadjAOverride - regaddrVadjAVoltage > off ) {
+			return regclassStatus;
+		}
+		if ( regaddrVadjACurrentAllowed - regaddrVadjAVoltage > off ) {
+			return regclassConfig;
+		}
+		if ( regaddrVadjACurrentRequested - regaddrVadjAVoltage > off ) {
+			return regclassStatic;
+		}
+		return regclassStatus;
+	}
+
+	/* VADJ_STATUS.
+	*/
+	if ( regaddrPortAI2cAddress > regaddr ) {
+		return regclassStatus;
+	}
+
+	/* PORT_n_STATUS changes when a pod is inserted or removed while the
+	** remaining port registers describe the board.
+	*/
+	off = (regaddr - regaddrPortAI2cAddress) % offsetPortReg;
+	return ( regaddrPortAStatus - regaddrPortAI2cAddress == off ) ? regclassStatus : regclassStatic;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionPmcuRead
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      addrRead        - memory address to read
+**      pbRead          - pointer to a buffer to receive data
+**      cbRead          - number of bytes to read
+**      pcbRead         - pointer to variable to receive count of bytes
+**                        read
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function reads the specified number of bytes from the
+**      Platform MCU starting at the specified address. If every byte of
+**      the range is present in the register cache and is still fresh
+**      then the read is served without accessing the bus. If another
+**      thread is already fetching a range that contains the requested
+**      range, and no register has been written since that fetch
+**      started, then this thread waits for that transaction and shares
+**      its result. Otherwise the range is read from the Platform MCU and
+**      stored in the cache.
+*/
+BOOL
+DpmSessionPmcuRead(DPM_SESSION* psess, WORD addrRead, BYTE* pbRead, BYTE cbRead, WORD* pcbRead) {
+
+	DPM_FLIGHT*	pflight;
+	WORD		ibFirst;
+	WORD		cbTrans;
+	DWORD		genWrite;
+	UINT64		usFetch;
+	WORD		ib;
+	BOOL		fRet;
+
+	cbTrans = 0;
+
+	if ( ! FShadowRange(addrRead, cbRead, &ibFirst) ) {
+		pthread_mutex_lock(&psess->mtxCache);
+		psess->stats.cUncached++;
+		psess->stats.cBusRead++;
+		pthread_mutex_unlock(&psess->mtxCache);
+
+		pthread_mutex_lock(&psess->mtxBus);
+		fRet = PmcuI2cRead(psess->fdI2c, addrRead, pbRead, cbRead, pcbRead);
+		pthread_mutex_unlock(&psess->mtxBus);
+
+		return fRet;
+	}
+
+	pthread_mutex_lock(&psess->mtxCache);
+
+	usFetch = UsMonotonic();
+	if ( FShadowFresh(psess, ibFirst, cbRead, usFetch) ) {
+		memcpy(pbRead, &psess->rgbShadow[ibFirst], cbRead);
+		psess->stats.cHit++;
+		pthread_mutex_unlock(&psess->mtxCache);
+
+		if ( NULL != pcbRead ) {
+			*pcbRead = cbRead;
+		}
+		return fTrue;
+	}
+
+	/* Share the result of a transaction that's already in progress if it
+	** covers the requested range.
+	*/
+	pflight = PflightFind(psess, ibFirst, cbRead);
+	if ( NULL != pflight ) {
+		psess->stats.cCoalesced++;
+		pflight->cWaiters++;
+		while ( ! pflight->fDone ) {
+			pthread_cond_wait(&psess->condFlight, &psess->mtxCache);
+		}
+
+		/* The fetch may have ended early, in which case only the bytes
+		** it received are returned.
+		*/
+		fRet = pflight->fResult;
+		cbTrans = 0;
+		if ( pflight->cbRecv > ibFirst - pflight->ibFirst ) {
+			cbTrans = pflight->cbRecv - (ibFirst - pflight->ibFirst);
+			if ( cbTrans > cbRead ) {
+				cbTrans = cbRead;
+			}
+			memcpy(pbRead, &pflight->rgb[ibFirst - pflight->ibFirst], cbTrans);
+		}
+		if ( cbTrans < cbRead ) {
+			fRet = fFalse;
+		}
+
+		pflight->cWaiters--;
+		if ( 0 == pflight->cWaiters ) {
+			pflight->fActive = fFalse;
+		}
+		pthread_mutex_unlock(&psess->mtxCache);
+
+		if ( NULL != pcbRead ) {
+			*pcbRead = cbTrans;
+		}
+		return fRet;
+	}
+
+	/* Perform the transaction ourselves. If every flight slot is in use
+	** the read still goes ahead, it just can't be shared.
+	*/
+	psess->stats.cMiss++;
+	pflight = PflightAlloc(psess, ibFirst, cbRead);
+	genWrite = psess->genWrite;
+	pthread_mutex_unlock(&psess->mtxCache);
+
+	pthread_mutex_lock(&psess->mtxBus);
+	fRet = PmcuI2cRead(psess->fdI2c, addrRead, pbRead, cbRead, &cbTrans);
+	pthread_mutex_unlock(&psess->mtxBus);
+
+	pthread_mutex_lock(&psess->mtxCache);
+
+	psess->stats.cBusRead++;
+
+	/* Only update the shadow if every byte was received and no register
+	** was written while the bus transaction was in progress, as the data
+	** may predate the write. Values are time stamped with the start of
+	** the transaction.
+	*/
+	if (( fRet ) && ( cbTrans == cbRead ) && ( genWrite == psess->genWrite )) {
+		memcpy(&psess->rgbShadow[ibFirst], pbRead, cbRead);
+		for ( ib = ibFirst; ib < ibFirst + cbRead; ib++ ) {
+			psess->rgusFetched[ib] = usFetch;
+		}
+	}
+
+	if ( NULL != pflight ) {
+		pflight->fResult = ( fRet ) && ( cbTrans == cbRead );
+		pflight->cbRecv = ( cbTrans < cbRead ) ? cbTrans : cbRead;
+		memcpy(pflight->rgb, pbRead, pflight->cbRecv);
+		pflight->fDone = fTrue;
+		if ( 0 == pflight->cWaiters ) {
+			pflight->fActive = fFalse;
+		}
+		pthread_cond_broadcast(&psess->condFlight);
+	}
+
+	pthread_mutex_unlock(&psess->mtxCache);
+
+	if ( NULL != pcbRead ) {
+		*pcbRead = cbTrans;
+	}
+
+	return fRet;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionPmcuWrite
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      addrWrite       - memory address to write
+**      pbWrite         - pointer to a buffer to containing data to transmit
+**      cbWrite         - number of bytes to write
+**      pcbWritten      - pointer to variable to receive count of bytes
+**                        written
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function writes the specified number of bytes to the
+**      Platform MCU starting at the specified address. Writing a
+**      configuration register can change the value of other
+**      configuration and status registers, so every cached register
+**      that isn't static is invalidated. Writing the software reset
+**      register invalidates the entire cache.
+*/
+BOOL
+DpmSessionPmcuWrite(DPM_SESSION* psess, WORD addrWrite, BYTE* pbWrite, BYTE cbWrite, WORD* pcbWritten) {
+
+	BOOL	fRet;
+
+	pthread_mutex_lock(&psess->mtxBus);
+	fRet = PmcuI2cWrite(psess->fdI2c, addrWrite, pbWrite, cbWrite, pcbWritten);
+	pthread_mutex_unlock(&psess->mtxBus);
+
+	pthread_mutex_lock(&psess->mtxCache);
+
+	psess->stats.cBusWrite++;
+	psess->genWrite++;
+
+	if ( regaddrSoftwareReset == addrWrite ) {
+		memset(psess->rgusFetched, 0, sizeof(psess->rgusFetched));
+	}
+	else {
+		InvalidateVolatile(psess);
+	}
+
+	pthread_mutex_unlock(&psess->mtxCache);
+
+	return fRet;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionSyzygyRead
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      addrI2cSlave    - I2C bus address for the slave
+**      addrRead        - memory address to read
+**      pbRead          - pointer to a buffer to receive data
+**      cbRead          - number of bytes to read
+**      pcbRead         - pointer to variable to receive count of bytes
+**                        read
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function reads the specified number of bytes from the
+**      SYZYGY pod with the specified I2C bus address. SYZYGY reads are
+**      not cached, but they are serialized with every other transaction
+**      of the session.
+*/
+BOOL
+DpmSessionSyzygyRead(DPM_SESSION* psess, BYTE addrI2cSlave, WORD addrRead, BYTE* pbRead, WORD cbRead, WORD* pcbRead) {
+
+	BOOL	fRet;
+
+	pthread_mutex_lock(&psess->mtxCache);
+	psess->stats.cUncached++;
+	psess->stats.cBusRead++;
+	pthread_mutex_unlock(&psess->mtxCache);
+
+	pthread_mutex_lock(&psess->mtxBus);
+	fRet = SyzygyI2cRead(psess->fdI2c, addrI2cSlave, addrRead, pbRead, cbRead, pcbRead);
+	pthread_mutex_unlock(&psess->mtxBus);
+
+	return fRet;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionSyzygyWrite
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      addrI2cSlave    - I2C bus address for the slave
+**      addrWrite       - memory address to write
+**      pbWrite         - pointer to a buffer to containing data to transmit
+**      cbWrite         - number of bytes to write
+**      pcbWritten      - pointer to variable to receive count of bytes
+**                        written
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function writes the specified number of bytes to the
+**      SYZYGY pod with the specified I2C bus address while holding the
+**      bus of the session.
+*/
+BOOL
+DpmSessionSyzygyWrite(DPM_SESSION* psess, BYTE addrI2cSlave, WORD addrWrite, BYTE* pbWrite, WORD cbWrite, WORD* pcbWritten) {
+
+	BOOL	fRet;
+
+	pthread_mutex_lock(&psess->mtxCache);
+	psess->stats.cBusWrite++;
+	pthread_mutex_unlock(&psess->mtxCache);
+
+	pthread_mutex_lock(&psess->mtxBus);
+	fRet = SyzygyI2cWrite(psess->fdI2c, addrI2cSlave, addrWrite, pbWrite, cbWrite, pcbWritten);
+	pthread_mutex_unlock(&psess->mtxBus);
+
+	return fRet;
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionLockBus
+**
+**  Parameters:
+**      psess           - pointer to the session
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function gives the calling thread exclusive use of the I2C
+**      bus so that it can issue transactions on psess->fdI2c directly.
+**      The controller of the session is also bound to the thread, so
+**      the dpmutil API functions called before DpmSessionUnlockBus use
+**      a duplicate of psess->fdI2c instead of opening the controller
+**      themselves. Every other transaction of the session waits until
+**      DpmSessionUnlockBus is called.
+*/
+void
+DpmSessionLockBus(DPM_SESSION* psess) {
+
+	pthread_mutex_lock(&psess->mtxBus);
+	I2CHALBindController(psess->fdI2c);
+}
+
+/* ------------------------------------------------------------ */
+/***    DpmSessionUnlockBus
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      fModified       - fTrue if Platform MCU registers may have been
+**                        written while the bus was locked
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function releases the I2C bus acquired by DpmSessionLockBus.
+**      If registers were modified then every cached register that isn't
+**      static is invalidated, as with DpmSessionPmcuWrite.
+*/
+void
+DpmSessionUnlockBus(DPM_SESSION* psess, BOOL fModified) {
+
+	I2CHALBindController(-1);
+	pthread_mutex_unlock(&psess->mtxBus);
+
+	if ( fModified ) {
+		pthread_mutex_lock(&psess->mtxCache);
+		psess->genWrite++;
+		InvalidateVolatile(psess);
+		pthread_mutex_unlock(&psess->mtxCache);
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    InvalidateVolatile
+**
+**  Parameters:
+**      psess           - pointer to the session
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function discards every cached register that isn't static.
+**      The caller must hold the cache lock.
+*/
+static void
+InvalidateVolatile(DPM_SESSION* psess) {
+
+	WORD	ib;
+
+	for ( ib = cbShadowFw; ib < cbShadow; ib++ ) {
+		if ( regclassStatic != DpmSessionRegClass(regaddrShadowCfgFirst + ib - cbShadowFw) ) {
+			psess->rgusFetched[ib] = 0;
+		}
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    UsMonotonic
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      current value of the monotonic clock in microseconds
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns a time stamp used to age cache entries.
+**      The value is never 0, which marks a cache entry as empty.
+*/
+static UINT64
+UsMonotonic() {
+
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((UINT64)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000) + 1;
+}
+
+/* ------------------------------------------------------------ */
+/***    FShadowRange
+**
+**  Parameters:
+**      addr            - first Platform MCU register address
+**      cb              - number of bytes
+**      pibFirst        - pointer to variable to receive the shadow index
+**                        of the first byte
+**
+**  Return Value:
+**      fTrue if the entire range can be cached, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function maps a Platform MCU register range onto the cache
+**      shadow. A range can only be cached if it lies entirely inside
+**      the firmware or the configuration registers and doesn't contain
+**      any uncacheable byte.
+*/
+static BOOL
+FShadowRange(WORD addr, WORD cb, WORD* pibFirst) {
+
+	WORD	ib;
+
+	if ( 0 == cb ) {
+		return fFalse;
+	}
+
+	if ( regaddrShadowFwFirst + cbShadowFw >= addr + cb ) {
+		*pibFirst = addr - regaddrShadowFwFirst;
+	}
+	else if (( regaddrShadowCfgFirst <= addr ) &&
+			 ( regaddrShadowCfgFirst + cbShadowCfg >= addr + cb )) {
+		*pibFirst = cbShadowFw + (addr - regaddrShadowCfgFirst);
+	}
+	else {
+		return fFalse;
+	}
+
+	for ( ib = 0; ib < cb; ib++ ) {
+		if ( regclassNone == DpmSessionRegClass(addr + ib) ) {
+			return fFalse;
+		}
+	}
+
+	return fTrue;
+}
+
+/* ------------------------------------------------------------ */
+/***    FShadowFresh
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      ibFirst         - shadow index of the first byte
+**      cb              - number of bytes
+**      usNow           - current time stamp
+**
+**  Return Value:
+**      fTrue if every byte of the range is fresh, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function checks whether a range of the shadow may be
+**      returned without accessing the bus. The caller must hold the
+**      cache lock.
+*/
+static BOOL
+FShadowFresh(DPM_SESSION* psess, WORD ibFirst, WORD cb, UINT64 usNow) {
+
+	WORD	ib;
+	WORD	regaddr;
+	UINT64	usTtl;
+
+	for ( ib = ibFirst; ib < ibFirst + cb; ib++ ) {
+		if ( 0 == psess->rgusFetched[ib] ) {
+			return fFalse;
+		}
+
+		regaddr = ( cbShadowFw > ib ) ? (regaddrShadowFwFirst + ib) : (regaddrShadowCfgFirst + ib - cbShadowFw);
+		usTtl = psess->rgusTtl[DpmSessionRegClass(regaddr)];
+		if (( usTtlForever != usTtl ) &&
+			( usNow - psess->rgusFetched[ib] >= usTtl )) {
+			return fFalse;
+		}
+	}
+
+	return fTrue;
+}
+
+/* ------------------------------------------------------------ */
+/***    PflightFind
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      ibFirst         - shadow index of the first byte
+**      cb              - number of bytes
+**
+**  Return Value:
+**      pointer to a transaction in progress that covers the range, NULL
+**      if there isn't one
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function searches for a bus transaction that another thread
+**      has started and that will return every byte of the specified
+**      range. A transaction started before the last write may return
+**      the values the write replaced, even if its bus access hasn't
+**      ended yet, so it isn't shared. The caller must hold the cache
+**      lock.
+*/
+static DPM_FLIGHT*
+PflightFind(DPM_SESSION* psess, WORD ibFirst, WORD cb) {
+
+	DWORD	iflight;
+
+	for ( iflight = 0; iflight < cflightMax; iflight++ ) {
+		if (( psess->rgflight[iflight].fActive ) &&
+			( ! psess->rgflight[iflight].fDone ) &&
+			( psess->rgflight[iflight].genWrite == psess->genWrite ) &&
+			( psess->rgflight[iflight].ibFirst <= ibFirst ) &&
+			( psess->rgflight[iflight].ibFirst + psess->rgflight[iflight].cb >= ibFirst + cb )) {
+			return &psess->rgflight[iflight];
+		}
+	}
+
+	return NULL;
+}
+
+/* ------------------------------------------------------------ */
+/***    PflightAlloc
+**
+**  Parameters:
+**      psess           - pointer to the session
+**      ibFirst         - shadow index of the first byte
+**      cb              - number of bytes
+**
+**  Return Value:
+**      pointer to the transaction slot, NULL if all slots are in use
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function registers a bus transaction so that other threads
+**      reading the same range can wait for its result. The caller must
+**      hold the cache lock.
+*/
+static DPM_FLIGHT*
+PflightAlloc(DPM_SESSION* psess, WORD ibFirst, WORD cb) {
+
+	DWORD	iflight;
+
+	for ( iflight = 0; iflight < cflightMax; iflight++ ) {
+		if ( ! psess->rgflight[iflight].fActive ) {
+			psess->rgflight[iflight].fActive = fTrue;
+			psess->rgflight[iflight].fDone = fFalse;
+			psess->rgflight[iflight].fResult = fFalse;
+			psess->rgflight[iflight].ibFirst = ibFirst;
+			psess->rgflight[iflight].cb = cb;
+			psess->rgflight[iflight].cbRecv = 0;
+			psess->rgflight[iflight].genWrite = psess->genWrite;
+			psess->rgflight[iflight].cWaiters = 0;
+			return &psess->rgflight[iflight];
+		}
+	}
+
+	return NULL;
+}
+
+#endif /* __linux__ */
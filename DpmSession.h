@@ -0,0 +1,147 @@
+/************************************************************************/
+/*                                                                      */
+/*  DpmSession.h - Thread-safe Platform MCU session definitions and     */
+/*      function declarations                                          */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file contains the declarations for a session object     */
+/*  that allows several threads of one process to share the I2C bus of  */
+/*  the Platform MCU and the SYZYGY pods. All bus transactions made     */
+/*  through a session are serialized. Platform MCU register reads are   */
+/*  served from a read-through register cache whose lifetime depends    */
+/*  on the class of the register, and concurrent reads of the same      */
+/*  register range are coalesced into a single bus transaction.         */
+/*                                                                      */
+/*  Sessions are only available on linux.                               */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef DPMSESSION_H_
+#define DPMSESSION_H_
+
+#include "stdtypes.h"
+
+#if defined(__linux__)
+
+#include <pthread.h>
+
+/* ------------------------------------------------------------ */
+/*                  Miscellaneous Declarations                  */
+/* ------------------------------------------------------------ */
+
+/* Define the classes of Platform MCU registers. Each class has its own
+** cache lifetime.
+**
+**  regclassStatic  - capabilities and board layout (counts, attributes,
+**                    current limits, port addresses, groups and types).
+**                    These never change while the PMCU is running.
+**  regclassConfig  - configuration registers that are only modified by
+**                    register writes (PLATFORM_CONFIGURATION,
+**                    FAN_n_CONFIGURATION, VADJ_n_OVERRIDE).
+**  regclassStatus  - measurements and status (temperatures, RPM,
+**                    requested currents, VADJ voltage and status, port
+**                    status).
+**  regclassNone    - registers that must never be cached.
+*/
+#define regclassStatic      0
+#define regclassConfig      1
+#define regclassStatus      2
+#define regclassNone        3
+#define cregclass           3
+
+/* Define the default cache lifetime (in microseconds) of each register
+** class.
+*/
+#define usTtlForever        0xFFFFFFFFFFFFFFFFULL
+#define usTtlStaticDefault  usTtlForever
+#define usTtlConfigDefault  100000
+#define usTtlStatusDefault  5000
+
+/* Define the Platform MCU register ranges held by the cache. The
+** firmware registers (PDID and FIRMWARE_VERSION) are followed by the
+** configuration registers in the cache shadow.
+*/
+#define regaddrShadowFwFirst    0x0000
+#define cbShadowFw              6
+#define regaddrShadowCfgFirst   0x8000
+#define cbShadowCfg             0xC0
+#define cbShadow                (cbShadowFw + cbShadowCfg)
+
+/* Define the maximum number of distinct register ranges that can be
+** fetched from the bus at the same time.
+*/
+#define cflightMax          8
+
+/* ------------------------------------------------------------ */
+/*                  General Type Declarations                   */
+/* ------------------------------------------------------------ */
+
+typedef struct {
+	BOOL	fActive;            // slot is in use
+	BOOL	fDone;              // bus transaction has completed
+	BOOL	fResult;            // result of the bus transaction
+	WORD	ibFirst;            // first shadow index fetched
+	WORD	cb;                 // number of bytes requested
+	WORD	cbRecv;             // number of bytes received
+	DWORD	genWrite;           // write generation when the fetch started
+	DWORD	cWaiters;           // threads waiting on this fetch
+	BYTE	rgb[cbShadow];      // data returned by the bus
+} DPM_FLIGHT;
+
+typedef struct {
+	UINT64	cHit;               // reads served from the cache
+	UINT64	cMiss;              // reads that required a bus transaction
+	UINT64	cCoalesced;         // reads that shared another thread's fetch
+	UINT64	cUncached;          // reads of uncacheable ranges
+	UINT64	cBusRead;           // read transactions issued on the bus
+	UINT64	cBusWrite;          // write transactions issued on the bus
+} DPM_SESSION_STATS;
+
+typedef struct {
+	int					fdI2c;
+	pthread_mutex_t		mtxCache;
+	pthread_cond_t		condFlight;
+	pthread_mutex_t		mtxBus;
+	UINT64				rgusTtl[cregclass];
+	UINT64				rgusFetched[cbShadow];
+	BYTE				rgbShadow[cbShadow];
+	DWORD				genWrite;
+	DPM_FLIGHT			rgflight[cflightMax];
+	DPM_SESSION_STATS	stats;
+} DPM_SESSION;
+
+/* ------------------------------------------------------------ */
+/*                  Variable Declarations                       */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/*                  Procedure Declarations                      */
+/* ------------------------------------------------------------ */
+
+BOOL	DpmSessionOpen(DPM_SESSION* psess);
+void	DpmSessionClose(DPM_SESSION* psess);
+void	DpmSessionSetTtl(DPM_SESSION* psess, BYTE regclass, UINT64 usTtl);
+void	DpmSessionInvalidate(DPM_SESSION* psess);
+void	DpmSessionGetStats(DPM_SESSION* psess, DPM_SESSION_STATS* pstats);
+BYTE	DpmSessionRegClass(WORD regaddr);
+BOOL	DpmSessionPmcuRead(DPM_SESSION* psess, WORD addrRead, BYTE* pbRead, BYTE cbRead, WORD* pcbRead);
+BOOL	DpmSessionPmcuWrite(DPM_SESSION* psess, WORD addrWrite, BYTE* pbWrite, BYTE cbWrite, WORD* pcbWritten);
+BOOL	DpmSessionSyzygyRead(DPM_SESSION* psess, BYTE addrI2cSlave, WORD addrRead, BYTE* pbRead, WORD cbRead, WORD* pcbRead);
+BOOL	DpmSessionSyzygyWrite(DPM_SESSION* psess, BYTE addrI2cSlave, WORD addrWrite, BYTE* pbWrite, WORD cbWrite, WORD* pcbWritten);
+void	DpmSessionLockBus(DPM_SESSION* psess);
+void	DpmSessionUnlockBus(DPM_SESSION* psess, BOOL fModified);
+
+#endif /* __linux__ */
+
+/* ------------------------------------------------------------ */
+
+#endif /* DPMSESSION_H_ */
@@ -0,0 +1,834 @@
+/************************************************************************/
+/*                                                                      */
+/*  DpmSoak.c - Platform MCU / SYZYGY bus soak test implementation      */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This source file contains the implementation of the soak test. The  */
+/*  test discovers the SYZYGY pods attached to the board and then, for  */
+/*  the requested duration, issues register reads to the Platform MCU   */
+/*  and the pods, DNA header reads to the pods and calibration reads to */
+/*  the Zmods, interleaved according to the requested weights. All      */
+/*  reads go through PmcuI2cRead and SyzygyI2cRead, so the numbers      */
+/*  include the pacing and retries of the HAL rate controller.          */
+/*                                                                      */
+/*  Latency is measured per read, as seen by the caller. NACK, timeout  */
+/*  and short read rates are taken from the per slave counters of the   */
+/*  HAL and are relative to bus transactions, including retries. The    */
+/*  HAL measures the interval between the address write and the read    */
+/*  of every transaction and counts it as clean or failed at the level  */
+/*  of that interval. The clean turnaround reported for a slave is the  */
+/*  start of the lowest level from which no read has failed. Reads      */
+/*  longer than 32 bytes are made of several transactions, each         */
+/*  measured on its own.                                                */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stdtypes.h"
+#include "I2CHAL.h"
+#include "PlatformMCU.h"
+#include "syzygy.h"
+#include "ZmodCal.h"
+#include "ZmodADC.h"
+#include "ZmodDAC.h"
+#include "DpmSoak.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+/* Define the kinds of reads issued by the soak test.
+*/
+#define opReg				0
+#define opDna				1
+#define opCal				2
+#define opMax				3
+
+/* Define the maximum number of slaves exercised: the Platform MCU and
+** a pod on each of up to 8 SmartVIO ports.
+*/
+#define ctgtMax				9
+#define cportSoakMax		8
+
+/* Define the maximum number of Platform MCU register ranges, see
+** FSoakDiscover.
+*/
+#define crangePmcuMax		6
+
+/* Define the size of the largest calibration area read.
+*/
+#define cbSoakCalMax		(( cbAdcCalMax > cbDacCalMax ) ? cbAdcCalMax : cbDacCalMax)
+
+/* Define the initial capacity of a latency sample buffer.
+*/
+#define csampInit			4096
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+typedef struct {
+	WORD	addr;
+	BYTE	cb;
+} SOAK_RANGE;
+
+typedef struct {
+	BYTE	addr;
+	char	chPort;         // '\0' for the Platform MCU
+	BOOL	fCal;           // pod has a known calibration area
+	WORD	addrCalFact;    // factory and user calibration areas of the pod
+	WORD	addrCalUser;
+	BYTE	cbCal;
+	UINT32	cread;          // reads issued, used to rotate between ranges
+} SOAK_TGT;
+
+typedef struct {
+	UINT32*	rgus;           // latency of each read in microseconds
+	UINT32	cus;
+	UINT32	cusMax;
+	UINT32	cread;
+	UINT32	cfail;
+	UINT64	cb;
+} SOAK_OP;
+
+/* ------------------------------------------------------------ */
+/*              Global Variables                                */
+/* ------------------------------------------------------------ */
+
+extern BOOL	dpmutilfVerbose;
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+/* Platform MCU register reads, sized by FSoakDiscover to the probes,
+** fans, supplies and ports the Platform MCU reports.
+*/
+static SOAK_RANGE	rgrangePmcu[crangePmcuMax];
+static BYTE			crangePmcu;
+
+/* SYZYGY pod register reads: the standard firmware registers and the
+** PDID.
+*/
+static const SOAK_RANGE	rgrangePod[] = {
+	{ 0x0000,						6 },
+	{ addrPdid,						4 },
+};
+
+static const char*	rgszOp[opMax] = { "register", "dna", "calibration" };
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static BOOL		FSoakDiscover(int fdI2c, SOAK_TGT rgtgt[], BYTE* pctgt);
+static void		SoakAddRange(WORD addr, BYTE cb);
+static BOOL		FSoakRead(int fdI2c, SOAK_TGT* ptgt, BYTE op, WORD* pcbRead);
+static BOOL		FSoakEligible(SOAK_TGT* ptgt, BYTE op);
+static void		SoakRecord(SOAK_OP* psop, UINT32 us);
+static void		SoakReport(SOAK_TGT rgtgt[], BYTE ctgt, SOAK_OP rgsop[], UINT64 usElapsed);
+static void		PrintLatency(const char* szName, SOAK_OP* psop);
+static UINT32	UsPercentile(SOAK_OP* psop, UINT32 permille);
+static int		CompareUs(const void* pv1, const void* pv2);
+static UINT64	UsSoakNow();
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/***    DpmSoakRun
+**
+**  Parameters:
+**      pcfg            - pointer to the soak parameters
+**
+**  Return Value:
+**      fTrue if the soak ran to completion, fFalse otherwise
+**
+**  Errors:
+**      Fails if the I2C controller can't be opened, if the Platform MCU
+**      can't be enumerated or if none of the requested reads applies to
+**      the slaves found. Failed reads during the soak are counted, not
+**      treated as errors.
+**
+**  Description:
+**      This function discovers the slaves on the bus, resets their rate
+**      controllers, issues reads of the requested mix for the requested
+**      duration and prints the results to stdout.
+**
+**      The kinds of read are interleaved by smooth weighted round robin
+**      and each kind rotates between the slaves it applies to.
+*/
+BOOL
+DpmSoakRun(const DPM_SOAK_CFG* pcfg) {
+
+	int			fdI2c;
+	SOAK_TGT	rgtgt[ctgtMax];
+	SOAK_OP		rgsop[opMax];
+	BYTE		ctgt;
+	BYTE		itgt;
+	BYTE		op;
+	BYTE		opNext;
+	UINT32		rgwt[opMax];
+	INT32		rgwtCur[opMax];
+	INT32		wtTotal;
+	UINT32		rgitgt[opMax];
+	UINT64		usStart;
+	UINT64		usEnd;
+	UINT64		usNow;
+	UINT64		usRead;
+	WORD		cbRead;
+	BOOL		fOk;
+	BOOL		fVerbose;
+	BOOL		fRet;
+
+	fRet = fFalse;
+	fVerbose = dpmutilfVerbose;
+	memset(rgsop, 0, sizeof(rgsop));
+
+	fdI2c = I2CHALOpenI2cController();
+	if ( 0 > fdI2c ) {
+		printf("ERROR: failed to open file descriptor for I2C device\n");
+		return fFalse;
+	}
+
+	if ( ! FSoakDiscover(fdI2c, rgtgt, &ctgt) ) {
+		goto lExit;
+	}
+
+	/* A kind of read that doesn't apply to any slave gets no weight.
+	*/
+	rgwt[opReg] = pcfg->wtReg;
+	rgwt[opDna] = pcfg->wtDna;
+	rgwt[opCal] = pcfg->wtCal;
+	wtTotal = 0;
+	for ( op = 0; op < opMax; op++ ) {
+		for ( itgt = 0; itgt < ctgt; itgt++ ) {
+			if ( FSoakEligible(&rgtgt[itgt], op) ) {
+				break;
+			}
+		}
+		if ( itgt == ctgt ) {
+			rgwt[op] = 0;
+		}
+		wtTotal += rgwt[op];
+		rgwtCur[op] = 0;
+		rgitgt[op] = 0;
+	}
+
+	if ( 0 == wtTotal ) {
+		printf("ERROR: none of the requested reads applies to the slaves found\n");
+		goto lExit;
+	}
+
+	for ( op = 0; op < opMax; op++ ) {
+		rgsop[op].rgus = (UINT32*)malloc(csampInit * sizeof(UINT32));
+		rgsop[op].cusMax = ( NULL != rgsop[op].rgus ) ? csampInit : 0;
+	}
+
+	/* Start every slave from the initial delays with clean counters.
+	*/
+	for ( itgt = 0; itgt < ctgt; itgt++ ) {
+		I2CHALResetRate(rgtgt[itgt].addr);
+	}
+	if ( pcfg->fFloor ) {
+		I2CHALSetTurnaroundFloor(addrPlatformMcuI2c, pcfg->usFloor);
+	}
+
+	printf("Soaking %d slave(s) for %u s, mix register %u / dna %u / calibration %u\n",
+		ctgt, (unsigned int)pcfg->sDuration, (unsigned int)rgwt[opReg], (unsigned int)rgwt[opDna], (unsigned int)rgwt[opCal]);
+	fflush(stdout);
+
+	/* The HAL reports every failed transaction when verbose output is
+	** enabled, which would swamp the results.
+	*/
+	dpmutilfVerbose = fFalse;
+
+	usStart = UsSoakNow();
+	usEnd = usStart + ((UINT64)pcfg->sDuration * 1000000);
+	usNow = usStart;
+
+	while ( usNow < usEnd ) {
+
+		/* Pick the kind of read.
+		*/
+		opNext = 0;
+		for ( op = 0; op < opMax; op++ ) {
+			rgwtCur[op] += rgwt[op];
+			if ( rgwtCur[op] > rgwtCur[opNext] ) {
+				opNext = op;
+			}
+		}
+		op = opNext;
+		rgwtCur[op] -= wtTotal;
+
+		/* Pick the next slave the read applies to.
+		*/
+		do {
+			itgt = rgitgt[op] % ctgt;
+			rgitgt[op]++;
+		} while ( ! FSoakEligible(&rgtgt[itgt], op) );
+
+		usRead = UsSoakNow();
+		cbRead = 0;
+		fOk = FSoakRead(fdI2c, &rgtgt[itgt], op, &cbRead);
+		usNow = UsSoakNow();
+
+		SoakRecord(&rgsop[op], (UINT32)(usNow - usRead));
+		rgsop[op].cb += cbRead;
+		if ( ! fOk ) {
+			rgsop[op].cfail++;
+		}
+	}
+
+	dpmutilfVerbose = fVerbose;
+
+	SoakReport(rgtgt, ctgt, rgsop, usNow - usStart);
+
+	fRet = fTrue;
+
+lExit:
+	for ( op = 0; op < opMax; op++ ) {
+		if ( NULL != rgsop[op].rgus ) {
+			free(rgsop[op].rgus);
+		}
+	}
+
+	close(fdI2c);
+
+	return fRet;
+}
+
+/* ------------------------------------------------------------ */
+/***    FSoakDiscover
+**
+**  Parameters:
+**      fdI2c           - open file descriptor for the I2C controller
+**      rgtgt           - array to receive the slaves
+**      pctgt           - pointer to variable to receive the slave count
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      Fails if the count registers or the SmartVIO port registers
+**      can't be read.
+**
+**  Description:
+**      This function lists the Platform MCU and the SYZYGY pod present
+**      on each SmartVIO port. A pod whose PDID identifies a ZmodADC or
+**      ZmodDAC also receives calibration reads, from the calibration
+**      areas of its own kind.
+**
+**      The register ranges read from the Platform MCU cover the
+**      firmware registers, the configuration registers through the
+**      last probe or fan present, the registers of each 5V0, 3V3 and
+**      VADJ supply present, and VADJ_STATUS with the registers of each
+**      port present.
+*/
+static BOOL
+FSoakDiscover(int fdI2c, SOAK_TGT rgtgt[], BYTE* pctgt) {
+
+	BYTE			rgbCount[regaddrPortCount - regaddrTempProbeCount + 1];
+	BYTE			cprobe;
+	BYTE			cfan;
+	BYTE			c5v0;
+	BYTE			c3v3;
+	BYTE			cvadj;
+	BYTE			csvioPorts;
+	BYTE			isvioPort;
+	BYTE			rgbPort[offsetPortReg];
+	PmcuPortStatus	portsts;
+	DWORD			pdid;
+	BYTE			ctgt;
+
+	memset(rgtgt, 0, ctgtMax * sizeof(SOAK_TGT));
+
+	rgtgt[0].addr = addrPlatformMcuI2c;
+	ctgt = 1;
+
+	if ( ! PmcuI2cRead(fdI2c, regaddrTempProbeCount, rgbCount, sizeof(rgbCount), NULL) ) {
+		printf("ERROR: failed to read the count registers\n");
+		return fFalse;
+	}
+
+	/* Clamp the counts to the number of register sets defined by the
+	** register map.
+	*/
+	cprobe = rgbCount[regaddrTempProbeCount - regaddrTempProbeCount];
+	cfan = rgbCount[regaddrFanCount - regaddrTempProbeCount];
+	c5v0 = rgbCount[regaddr5v0GroupCount - regaddrTempProbeCount];
+	c3v3 = rgbCount[regaddr3v3GroupCount - regaddrTempProbeCount];
+	cvadj = rgbCount[regaddrVadjGroupCount - regaddrTempProbeCount];
+	csvioPorts = rgbCount[regaddrPortCount - regaddrTempProbeCount];
+
+	if ( 4 < cprobe ) cprobe = 4;
+	if ( 4 < cfan ) cfan = 4;
+	if ( 4 < c5v0 ) c5v0 = 4;
+	if ( 4 < c3v3 ) c3v3 = 4;
+	if ( 8 < cvadj ) cvadj = 8;
+	if ( cportSoakMax < csvioPorts ) csvioPorts = cportSoakMax;
+
+	crangePmcu = 0;
+	SoakAddRange(regaddrPDID, 6);
+	if ( 0 < cfan ) {
+		SoakAddRange(regaddrConfigurationVersion, regaddrFan1Capabilities + (offsetFanReg*cfan) - regaddrConfigurationVersion);
+	}
+	else {
+		SoakAddRange(regaddrConfigurationVersion, regaddrTemp1Attributes + (offsetTemperatureReg*cprobe) - regaddrConfigurationVersion);
+	}
+	SoakAddRange(regaddr5v0ACurrentAllowed, offset5v0Reg*c5v0);
+	SoakAddRange(regaddr3v3ACurrentAllowed, offset3v3Reg*c3v3);
+	SoakAddRange(regaddrVadjAVoltage, offsetVadjReg*cvadj);
+	SoakAddRange(regaddrVadjStatus, (regaddrPortAI2cAddress - regaddrVadjStatus) + (offsetPortReg*csvioPorts));
+
+	for ( isvioPort = 0; isvioPort < csvioPorts; isvioPort++ ) {
+
+		if ( ! PmcuI2cRead(fdI2c, regaddrPortAI2cAddress + (offsetPortReg*isvioPort), rgbPort, offsetPortReg, NULL) ) {
+			printf("ERROR: failed to read PORT_%c registers\n", 0x41 + isvioPort);
+			return fFalse;
+		}
+
+		memcpy(&portsts, &rgbPort[regaddrPortAStatus - regaddrPortAI2cAddress], 1);
+		if (( ! portsts.fPresent ) ||
+			( ! IsSyzygyPort(rgbPort[regaddrPortAType - regaddrPortAI2cAddress]) )) {
+			continue;
+		}
+
+		rgtgt[ctgt].addr = rgbPort[0];
+		rgtgt[ctgt].chPort = 0x41 + isvioPort;
+
+		if ( SyzygyI2cRead(fdI2c, rgtgt[ctgt].addr, addrPdid, (BYTE*)&pdid, 4, NULL) ) {
+			switch ( ProductFromPdid(pdid) ) {
+				case prodZmodADC:
+					rgtgt[ctgt].fCal = fTrue;
+					rgtgt[ctgt].addrCalFact = addrAdcFactCalStart;
+					rgtgt[ctgt].addrCalUser = addrAdcUserCalStart;
+					rgtgt[ctgt].cbCal = cbAdcCalMax;
+					break;
+
+				case prodZmodDAC:
+					rgtgt[ctgt].fCal = fTrue;
+					rgtgt[ctgt].addrCalFact = addrDacFactCalStart;
+					rgtgt[ctgt].addrCalUser = addrDacUserCalStart;
+					rgtgt[ctgt].cbCal = cbDacCalMax;
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		ctgt++;
+	}
+
+	*pctgt = ctgt;
+
+	return fTrue;
+}
+
+/* ------------------------------------------------------------ */
+/***    SoakAddRange
+**
+**  Parameters:
+**      addr            - first register of the range
+**      cb              - number of bytes in the range
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function adds a range to the Platform MCU register reads,
+**      unless it's empty because no resource of its type is present.
+*/
+static void
+SoakAddRange(WORD addr, BYTE cb) {
+
+	if (( 0 == cb ) || ( crangePmcuMax <= crangePmcu )) {
+		return;
+	}
+
+	rgrangePmcu[crangePmcu].addr = addr;
+	rgrangePmcu[crangePmcu].cb = cb;
+	crangePmcu++;
+}
+
+/* ------------------------------------------------------------ */
+/***    FSoakRead
+**
+**  Parameters:
+**      fdI2c           - open file descriptor for the I2C controller
+**      ptgt            - slave to read
+**      op              - kind of read
+**      pcbRead         - pointer to variable to receive the count of
+**                        bytes read
+**
+**  Return Value:
+**      fTrue for success, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function performs one read of the specified kind. Register
+**      reads rotate between the ranges listed for the slave and
+**      calibration reads alternate between the factory and the user
+**      calibration areas.
+*/
+static BOOL
+FSoakRead(int fdI2c, SOAK_TGT* ptgt, BYTE op, WORD* pcbRead) {
+
+	BYTE				rgb[cbSoakCalMax];
+	const SOAK_RANGE*	prange;
+	WORD				addr;
+
+	ptgt->cread++;
+
+	switch ( op ) {
+		case opReg:
+			if ( '\0' == ptgt->chPort ) {
+				prange = &rgrangePmcu[ptgt->cread % crangePmcu];
+				return PmcuI2cRead(fdI2c, prange->addr, rgb, prange->cb, pcbRead);
+			}
+			prange = &rgrangePod[ptgt->cread % (sizeof(rgrangePod) / sizeof(SOAK_RANGE))];
+			return SyzygyI2cRead(fdI2c, ptgt->addr, prange->addr, rgb, prange->cb, pcbRead);
+
+		case opDna:
+			return SyzygyI2cRead(fdI2c, ptgt->addr, addrDnaStart, rgb, cbSyzygyDnaHeader, pcbRead);
+
+		case opCal:
+			addr = ( ptgt->cread & 1 ) ? ptgt->addrCalUser : ptgt->addrCalFact;
+			return SyzygyI2cRead(fdI2c, ptgt->addr, addr, rgb, ptgt->cbCal, pcbRead);
+
+		default:
+			return fFalse;
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    FSoakEligible
+**
+**  Parameters:
+**      ptgt            - slave to check
+**      op              - kind of read
+**
+**  Return Value:
+**      fTrue if the kind of read applies to the slave, fFalse otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      Register reads apply to every slave, DNA reads to every pod and
+**      calibration reads to the Zmods with a known calibration area.
+*/
+static BOOL
+FSoakEligible(SOAK_TGT* ptgt, BYTE op) {
+
+	switch ( op ) {
+		case opReg:
+			return fTrue;
+
+		case opDna:
+			return ( '\0' != ptgt->chPort );
+
+		case opCal:
+			return ptgt->fCal;
+
+		default:
+			return fFalse;
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    SoakRecord
+**
+**  Parameters:
+**      psop            - statistics of the kind of read
+**      us              - latency of the read in microseconds
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function counts a read and stores its latency, growing the
+**      sample buffer as required. If the buffer can't be grown the read
+**      is still counted but its latency isn't sampled.
+*/
+static void
+SoakRecord(SOAK_OP* psop, UINT32 us) {
+
+	UINT32*	rgus;
+
+	psop->cread++;
+
+	if ( psop->cus == psop->cusMax ) {
+		rgus = ( 0 < psop->cusMax ) ? (UINT32*)realloc(psop->rgus, 2 * psop->cusMax * sizeof(UINT32)) : NULL;
+		if ( NULL == rgus ) {
+			return;
+		}
+		psop->rgus = rgus;
+		psop->cusMax *= 2;
+	}
+
+	psop->rgus[psop->cus] = us;
+	psop->cus++;
+}
+
+/* ------------------------------------------------------------ */
+/***    SoakReport
+**
+**  Parameters:
+**      rgtgt           - slaves exercised
+**      ctgt            - number of slaves
+**      rgsop           - statistics of each kind of read
+**      usElapsed       - duration of the soak in microseconds
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function prints the throughput, the latency percentiles of
+**      each kind of read and the error rates and delays of each slave.
+*/
+static void
+SoakReport(SOAK_TGT rgtgt[], BYTE ctgt, SOAK_OP rgsop[], UINT64 usElapsed) {
+
+	SOAK_OP				sopAll;
+	I2CHAL_RATE_STATS	stats;
+	UINT64				ctx;
+	UINT64				cb;
+	double				s;
+	double				pctTx;
+	BYTE				itgt;
+	BYTE				op;
+
+	s = usElapsed / 1000000.0;
+	if ( 0 >= s ) {
+		s = 1e-6;
+	}
+
+	/* Combine the samples of every kind of read for the overall
+	** percentiles.
+	*/
+	memset(&sopAll, 0, sizeof(SOAK_OP));
+	for ( op = 0; op < opMax; op++ ) {
+		sopAll.cread += rgsop[op].cread;
+		sopAll.cfail += rgsop[op].cfail;
+		sopAll.cb += rgsop[op].cb;
+		sopAll.cusMax += rgsop[op].cus;
+	}
+	if ( 0 < sopAll.cusMax ) {
+		sopAll.rgus = (UINT32*)malloc(sopAll.cusMax * sizeof(UINT32));
+		if ( NULL != sopAll.rgus ) {
+			for ( op = 0; op < opMax; op++ ) {
+				memcpy(&sopAll.rgus[sopAll.cus], rgsop[op].rgus, rgsop[op].cus * sizeof(UINT32));
+				sopAll.cus += rgsop[op].cus;
+			}
+		}
+	}
+
+	ctx = 0;
+	for ( itgt = 0; itgt < ctgt; itgt++ ) {
+		if ( I2CHALGetRateStats(rgtgt[itgt].addr, &stats) ) {
+			ctx += stats.cTx;
+		}
+	}
+	cb = sopAll.cb;
+
+	printf("\n");
+	printf("DURATION:                        %.1f s\n", s);
+	printf("READS:                           %u (%.1f/s), %u failed\n", (unsigned int)sopAll.cread, sopAll.cread / s, (unsigned int)sopAll.cfail);
+	printf("BUS_TRANSACTIONS:                %llu (%.1f/s)\n", (unsigned long long)ctx, ctx / s);
+	printf("BYTES_READ:                      %llu (%.1f/s)\n", (unsigned long long)cb, cb / s);
+
+	printf("\nLATENCY (us)         reads      p50      p90      p99    p99.9      max   failed\n");
+	for ( op = 0; op < opMax; op++ ) {
+		if ( 0 < rgsop[op].cread ) {
+			PrintLatency(rgszOp[op], &rgsop[op]);
+		}
+	}
+	PrintLatency("all", &sopAll);
+
+	printf("\nSLAVE (delays in us)\n");
+	printf("%-14s%9s %7s %9s %8s %6s %5s %8s %5s %9s\n",
+		"", "tx", "nack%", "timeout%", "short%", "fail", "delay", "clean", "floor", "gap");
+	for ( itgt = 0; itgt < ctgt; itgt++ ) {
+		if ( ! I2CHALGetRateStats(rgtgt[itgt].addr, &stats) ) {
+			continue;
+		}
+
+		pctTx = ( 0 < stats.cTx ) ? 100.0 / stats.cTx : 0;
+		if ( '\0' == rgtgt[itgt].chPort ) {
+			printf("  0x%02X PMCU    ", rgtgt[itgt].addr);
+		}
+		else {
+			printf("  0x%02X PORT_%c  ", rgtgt[itgt].addr, rgtgt[itgt].chPort);
+		}
+		printf("%8u %7.3f %9.3f %8.3f %6u %5u ",
+			(unsigned int)stats.cTx, stats.cNack * pctTx, stats.cTimeout * pctTx, stats.cShort * pctTx,
+			(unsigned int)stats.cFail, (unsigned int)stats.usTurnaround);
+#if DPMUTIL_CFG_RATE
+		if (( 0 < stats.cHeld ) && ( usHeldNone != stats.usHeldClean )) {
+			printf("%8u ", (unsigned int)stats.usHeldClean);
+		}
+		else {
+			printf("%8s ", "-");
+		}
+#else
+		printf("%8s ", "-");
+#endif
+		printf("%5u %9u\n", (unsigned int)stats.usTurnaroundMin, (unsigned int)stats.usGap);
+	}
+
+	if ( NULL != sopAll.rgus ) {
+		free(sopAll.rgus);
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    PrintLatency
+**
+**  Parameters:
+**      szName          - name of the kind of read
+**      psop            - statistics of the kind of read
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function prints one row of the latency table. The samples
+**      are sorted in place.
+*/
+static void
+PrintLatency(const char* szName, SOAK_OP* psop) {
+
+	if ( 0 == psop->cus ) {
+		printf("  %-14s %9u %8s %8s %8s %8s %8s %8u\n", szName, (unsigned int)psop->cread, "-", "-", "-", "-", "-", (unsigned int)psop->cfail);
+		return;
+	}
+
+	qsort(psop->rgus, psop->cus, sizeof(UINT32), CompareUs);
+
+	printf("  %-14s %9u %8u %8u %8u %8u %8u %8u\n", szName, (unsigned int)psop->cread,
+		(unsigned int)UsPercentile(psop, 500), (unsigned int)UsPercentile(psop, 900),
+		(unsigned int)UsPercentile(psop, 990), (unsigned int)UsPercentile(psop, 999),
+		(unsigned int)psop->rgus[psop->cus - 1], (unsigned int)psop->cfail);
+}
+
+/* ------------------------------------------------------------ */
+/***    UsPercentile
+**
+**  Parameters:
+**      psop            - statistics with sorted latency samples
+**      permille        - percentile in tenths of a percent
+**
+**  Return Value:
+**      latency at the percentile in microseconds
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns the nearest rank percentile of the samples.
+*/
+static UINT32
+UsPercentile(SOAK_OP* psop, UINT32 permille) {
+
+	UINT64	irank;
+
+	irank = (((UINT64)permille * psop->cus) + 999) / 1000;
+	if ( 0 < irank ) {
+		irank--;
+	}
+	if ( psop->cus <= irank ) {
+		irank = psop->cus - 1;
+	}
+
+	return psop->rgus[irank];
+}
+
+/* ------------------------------------------------------------ */
+/***    CompareUs
+**
+**  Parameters:
+**      pv1             - pointer to the first sample
+**      pv2             - pointer to the second sample
+**
+**  Return Value:
+**      negative, zero or positive as for qsort
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function orders latency samples for qsort.
+*/
+static int
+CompareUs(const void* pv1, const void* pv2) {
+
+	UINT32	us1;
+	UINT32	us2;
+
+	us1 = *(const UINT32*)pv1;
+	us2 = *(const UINT32*)pv2;
+
+	return ( us1 > us2 ) - ( us1 < us2 );
+}
+
+/* ------------------------------------------------------------ */
+/***    UsSoakNow
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      current value of the monotonic clock in microseconds
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns a time stamp used to measure latency.
+*/
+static UINT64
+UsSoakNow() {
+
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((UINT64)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,69 @@
+/************************************************************************/
+/*                                                                      */
+/*  DpmSoak.h - Platform MCU / SYZYGY bus soak test declarations        */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file contains the declarations for a soak test that     */
+/*  exercises the Platform MCU and every attached SYZYGY pod with a mix */
+/*  of register, DNA and calibration reads for a fixed duration and     */
+/*  reports the throughput, latency and error rates that the bus        */
+/*  sustained.                                                          */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef DPMSOAK_H_
+#define DPMSOAK_H_
+
+#include "stdtypes.h"
+
+#if defined(__linux__)
+
+/* ------------------------------------------------------------ */
+/*                  Miscellaneous Declarations                  */
+/* ------------------------------------------------------------ */
+
+/* Define the default soak parameters.
+*/
+#define sSoakDurationDefault	10
+#define wtSoakRegDefault		4
+#define wtSoakDnaDefault		1
+#define wtSoakCalDefault		1
+
+/* ------------------------------------------------------------ */
+/*                  General Type Declarations                   */
+/* ------------------------------------------------------------ */
+
+/* The relative weights select how often each kind of read is issued.
+** When fFloor is set the rate controller of the Platform MCU may
+** tighten the turnaround delay down to usFloor instead of the minimum
+** documented for the device.
+*/
+typedef struct {
+	UINT32	sDuration;
+	UINT32	wtReg;
+	UINT32	wtDna;
+	UINT32	wtCal;
+	BOOL	fFloor;
+	UINT32	usFloor;
+} DPM_SOAK_CFG;
+
+/* ------------------------------------------------------------ */
+/*                  Procedure Declarations                      */
+/* ------------------------------------------------------------ */
+
+BOOL	DpmSoakRun(const DPM_SOAK_CFG* pcfg);
+
+#endif
+
+/* ------------------------------------------------------------ */
+
+#endif /* DPMSOAK_H_ */
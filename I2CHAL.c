@@ -26,6 +26,8 @@
 /* ------------------------------------------------------------ */
 
 #include "I2CHAL.h"
+#include "PlatformMCU.h"
+#include "dpmutilcfg.h"
 #if defined(__linux__)
 #include <fcntl.h>
 #include <unistd.h>
@@ -36,14 +38,26 @@
 #include <sys/types.h>
 #include <sys/ioctl.h>
 #include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#if defined(I2CHAL_SIM)
+#include "I2CSim.h"
+#define ioctl	I2CSimIoctl
+#define write	I2CSimWrite
+#define read	I2CSimRead
+#endif
 const char szI2cDeviceName[] = "pmcu-i2c";
 const char szI2cDeviceNameDefault[] = "/dev/i2c-1";
 #else
+/* Baremetal designs drive a single controller from a single thread, so
+** the controller instance is shared by the whole program.
+*/
 static Iic IicDev;
 static BOOL Iic_Init=fFalse;
 #include "sleep.h"
 #endif
 #include <stdio.h>
+#include <string.h>
 
 
 /* ------------------------------------------------------------ */
@@ -55,10 +69,64 @@ static BOOL Iic_Init=fFalse;
  */
 #define IIC_SCLK_RATE 		400000
 
+/* Define the outcome of a single bus transaction. When the slave NACKs
+** its address nothing has reached it, so any transaction may be tried
+** again. After a NACK of a data byte, a lost arbitration or a timeout
+** part of a write may already have been applied, so only reads are
+** tried again.
+*/
+#define i2cstsOk			0
+#define i2cstsNack			1
+#define i2cstsError			2
+#define i2cstsTimeout		3
+#define i2cstsBusError		4
+
+/* Define the outcome of a transaction as seen by the rate controller.
+*/
+#define rateresClean		0
+#define rateresShort		1
+#define rateresBusy			2
+#define rateresNack			3
+#define rateresError		4
+
+/* Define the parameters of the per slave rate controller, see RateDone.
+** Delays are in microseconds. A transaction is attempted at most
+** ctryI2cMax times. When more than crateMax slaves are addressed the
+** controller of the least recently used one is discarded, see PrateGet.
+** Without DPMUTIL_CFG_RATE a single controller is kept, so it starts
+** over from the initial delays whenever the slave changes.
+*/
+#if DPMUTIL_CFG_RATE
+#define crateMax			12
+#else
+#define crateMax			1
+#endif
+#define ctryI2cMax			10
+#define usTurnaroundInit	50
+#define usTurnaroundInc		10
+#define usTurnaroundDec		2
+#define usTurnaroundMax		2000
+#define ccleanTighten		8
+#define usGapInc			100
+#define hzGapInc			100
+#define usGapMax			100000
+
 /* ------------------------------------------------------------ */
 /*              Local Type Definitions                          */
 /* ------------------------------------------------------------ */
 
+typedef struct {
+	BOOL				fUsed;
+	BYTE				addr;
+	UINT32				cClean;     // clean transactions since the last change
+	UINT64				usLast;     // end of the last transaction (linux only)
+	BOOL				fFloor;     // usFloor overrides the device minimum
+	UINT32				usFloor;
+	UINT64				seqUse;     // when the controller was last claimed
+	BYTE				cref;       // transactions using the controller
+	I2CHAL_RATE_STATS	stats;
+} I2CHAL_RATE;
+
 
 /* ------------------------------------------------------------ */
 /*              Global Variables                                */
@@ -70,11 +138,39 @@ extern BOOL	dpmutilfVerbose;
 /*              Local Variables                                 */
 /* ------------------------------------------------------------ */
 
+static I2CHAL_RATE		rgrate[crateMax];
+static UINT64			seqRateUse = 0;
+#if defined(__linux__)
+static pthread_mutex_t	mtxRate = PTHREAD_MUTEX_INITIALIZER;
+static __thread int		fdI2cBound = -1;
+#endif
+
 
 /* ------------------------------------------------------------ */
 /*              Forward Declarations                            */
 /* ------------------------------------------------------------ */
 
+static BYTE			StsI2cSend(int fdI2cDev, BYTE slaveAddr, BYTE* pbSnd, BYTE cbSnd);
+static BYTE			StsI2cRecv(int fdI2cDev, BYTE slaveAddr, BYTE* pbRecv, BYTE cbRecv, ssize_t* pcbRecv);
+static I2CHAL_RATE*	PrateFind(BYTE slaveAddr);
+static I2CHAL_RATE*	PrateGet(BYTE slaveAddr, UINT32 usFloor);
+static void			RateRelease(I2CHAL_RATE* prate);
+static UINT32		RatePace(I2CHAL_RATE* prate);
+static void			RateDone(I2CHAL_RATE* prate, BYTE rateres);
+static void			RateFailed(I2CHAL_RATE* prate, BYTE rateres);
+static void			RateTimedOut(I2CHAL_RATE* prate);
+static void			RateHeld(I2CHAL_RATE* prate, UINT32 usHeld, BOOL fClean);
+#if DPMUTIL_CFG_RATE
+static BYTE			IlevelHeld(UINT32 usHeld);
+#endif
+static void			RateLock();
+static void			RateUnlock();
+static void			DelayUs(UINT32 us);
+#if defined(__linux__)
+static BYTE			StsFromErrno();
+static UINT64		UsNow();
+#endif
+
 
 /* ------------------------------------------------------------ */
 /*              Procedure Definitions                           */
@@ -100,6 +196,10 @@ extern BOOL	dpmutilfVerbose;
 **      that's connected to I2C bus shared by the Platform MCU and
 **      SmartVIO ports.
 **
+**      If a controller has been bound to the calling thread with
+**      I2CHALBindController then a duplicate of its file descriptor is
+**      returned instead.
+**
 **  Notes:
 **      It is the callers responsibility to close the file descriptor
 **      when he/she is done using it by calling the close() function.
@@ -115,9 +215,17 @@ I2CHALOpenI2cController() {
 	int				ch;
 	WORD			cchRead;
 
+	if ( 0 <= fdI2cBound ) {
+		return dup(fdI2cBound);
+	}
+
+#if defined(I2CHAL_SIM)
+	return I2CSimOpen(szI2cDeviceNameDefault, O_RDWR);
+#endif
+
 	pdir = opendir("/sys/bus/i2c/devices/");
 	if ( NULL == pdir ) {
-		printf("ERROR: opendir failed to open \"/sys/bus/i2c/devices/\"");
+		DpmPrintf("ERROR: opendir failed to open \"/sys/bus/i2c/devices/\"");
 		return -1;
 	}
 
@@ -176,6 +284,33 @@ I2CHALOpenI2cController() {
 	closedir(pdir);
 	return open(szFilePath, O_RDWR);
 }
+
+/* ------------------------------------------------------------ */
+/***    I2CHALBindController
+**
+**  Parameters:
+**      fdI2cDev        - open file descriptor for the I2C controller, less
+**                        than zero to remove the binding
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function binds an open controller to the calling thread.
+**      While the binding is in place I2CHALOpenI2cController returns a
+**      duplicate of fdI2cDev, so code that opens the controller for
+**      itself, such as the dpmutil API functions, issues its
+**      transactions on the controller of the caller. The caller must
+**      serialize access to fdI2cDev, see DpmSessionLockBus.
+*/
+void
+I2CHALBindController(int fdI2cDev) {
+
+	fdI2cBound = fdI2cDev;
+}
 #else
 
 /* ------------------------------------------------------------ */
@@ -220,6 +355,149 @@ I2CHALInit(UINT32 deviceID){
 }
 #endif
 
+/* ------------------------------------------------------------ */
+/***    I2CHALGetRateStats
+**
+**  Parameters:
+**      slaveAddr       - slave address of the device
+**      pstats          - pointer to a structure to receive the counters
+**                        and current delays
+**
+**  Return Value:
+**      fTrue for success, fFalse if no transaction has been addressed
+**      to the slave
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns the transaction counters and the delays
+**      currently chosen by the rate controller for the specified slave.
+*/
+BOOL
+I2CHALGetRateStats(BYTE slaveAddr, I2CHAL_RATE_STATS* pstats) {
+
+	I2CHAL_RATE*	prate;
+	BOOL			fRet;
+
+	RateLock();
+
+	fRet = fFalse;
+	prate = PrateFind(slaveAddr);
+	if ( NULL != prate ) {
+		*pstats = prate->stats;
+		fRet = fTrue;
+	}
+
+	RateUnlock();
+
+	return fRet;
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CHALResetRate
+**
+**  Parameters:
+**      slaveAddr       - slave address of the device
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function discards the counters and the delays learned for
+**      the specified slave, so that the next transaction starts from the
+**      initial, conservative, delays.
+*/
+void
+I2CHALResetRate(BYTE slaveAddr) {
+
+	I2CHAL_RATE*	prate;
+
+	RateLock();
+
+	prate = PrateFind(slaveAddr);
+	if ( NULL != prate ) {
+		prate->fUsed = fFalse;
+	}
+
+	RateUnlock();
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CHALSetTurnaroundFloor
+**
+**  Parameters:
+**      slaveAddr       - slave address of the device
+**      usFloor         - minimum turnaround delay in microseconds
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function replaces the minimum turnaround delay that callers
+**      pass for the specified slave, so that the rate controller can be
+**      allowed to tighten the delay below the documented minimum of the
+**      device while characterising the bus. The override lasts until
+**      I2CHALResetRate is called for the slave, or until the controller
+**      of the slave is discarded to make room for other slaves.
+*/
+void
+I2CHALSetTurnaroundFloor(BYTE slaveAddr, UINT32 usFloor) {
+
+	I2CHAL_RATE*	prate;
+
+	prate = PrateGet(slaveAddr, usFloor);
+	if ( NULL == prate ) {
+		return;
+	}
+
+	RateLock();
+	prate->fFloor = fTrue;
+	prate->usFloor = usFloor;
+	prate->stats.usTurnaroundMin = usFloor;
+	RateUnlock();
+
+	RateRelease(prate);
+}
+
+#if DPMUTIL_CFG_RATE
+/* ------------------------------------------------------------ */
+/***    I2CHALHeldLevel
+**
+**  Parameters:
+**      ilevel          - level of the turnaround interval statistics
+**
+**  Return Value:
+**      shortest interval counted at the level, in microseconds
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns where a level of the rgcHeldClean and
+**      rgcHeldFail statistics starts. The first clevelHeldFine levels
+**      are usHeldFine microseconds wide so that the intervals around
+**      the documented minimums of the devices are told apart, and the
+**      rest are usHeldCoarse microseconds wide to reach the longest
+**      delay the rate controller chooses.
+*/
+UINT32
+I2CHALHeldLevel(BYTE ilevel) {
+
+	if ( ilevel < clevelHeldFine ) {
+		return ilevel * usHeldFine;
+	}
+
+	return clevelHeldFine * usHeldFine + (ilevel - clevelHeldFine) * usHeldCoarse;
+}
+#endif
+
 /* ------------------------------------------------------------ */
 /***    PmcuI2cRead
 **
@@ -231,7 +509,8 @@ I2CHALInit(UINT32 deviceID){
 **      cbRead          - number of bytes to read
 **      pcbRead         - pointer to variable to receive count of bytes
 **                        read
-**      uWait			- number of microseconds to wait between reads
+**      uWait			- minimum number of microseconds the device requires
+**                        between the address write and the read
 **
 **  Return Value:
 **      fTrue for success, fFalse otherwise
@@ -244,134 +523,190 @@ I2CHALInit(UINT32 deviceID){
 **      Platform MCU starting at the specified address. Read operations
 **      may be split into multiple transactions with a maximum of
 **      cbPmcuTxMax bytes being retrieved during a single read operation.
+**
+**      The delay between the address write and the read, and the spacing
+**      between transactions, are chosen by the rate controller of the
+**      slave. A transaction that's NACKed widens both and is retried.
+**      The interval actually left between the address write and the
+**      read is measured for every transaction whose address write the
+**      slave accepts, and counted as clean or failed at its level in the
+**      statistics of the slave. USDT probes mark the
+**      pacing delay, the address write, the turnaround delay and the
+**      data read of every attempt.
 */
 BOOL
 I2CHALRead(int fdI2cDev, BYTE slaveAddr, WORD addrRead, BYTE* pbRead, BYTE cbRead, WORD* pcbRead, UINT32 uWait) {
 
+	I2CHAL_RATE*	prate;
 	ssize_t			cbTrans;
 	ssize_t			cb;
 	BYTE			cbRecv;
 	BYTE			rgbSnd[2];
-	char			szErr[64];
-	char			szErrDesc[128];
-
-//
+	BYTE			ctry;
+	BYTE			sts;
+	BYTE			rateres;
+	UINT32			usTurnaround;
+	UINT32			usHeld;
+#if defined(__linux__)
+	UINT64			usAddrDone;
+#endif
+	const char*		szErrDesc;
 
 	cbRecv = 0;
-	strcpy(szErr, "ERROR: PmcuI2cRead - ");
-	szErrDesc[0] = '\0';
+	prate = NULL;
+	szErrDesc = "";
+
+	DpmProbe3(read__entry, slaveAddr, addrRead, cbRead);
 
 	/* Inform the I2C driver of the slave address.
 	*/
 #if defined(__linux__)
-	struct timespec	tsWait;
 	if ( 0 > ioctl(fdI2cDev, I2C_SLAVE, slaveAddr) ) {
-		sprintf(szErrDesc, "failed to set I2C slave address");
+		szErrDesc = "failed to set I2C slave address";
 		goto lErrorExit;
 	}
-	tsWait.tv_sec = 0;
-	tsWait.tv_nsec = 50000;
-#endif
-
-	while ( cbRecv < cbRead ) {
-
-		/* Transmit the memory address to the slave.
-		*/
-		rgbSnd[0] = (addrRead  >> 8);
-		rgbSnd[1] = addrRead & 0xFF;
-
-#if defined(__linux__)
-		if ( 2 != write(fdI2cDev, rgbSnd, 2) ) {
-			sprintf(szErrDesc, "failed to write memory address");
-			goto lErrorExit;
-		}
-#elif defined(PLATFORM_ZYNQ)
-		// Send the read address
-		if(XST_SUCCESS != XIicPs_MasterSendPolled(&IicDev, rgbSnd, 2, slaveAddr)){
-			strcpy(szErrDesc, "failed to write memory address");
-			goto lErrorExit;
-		}
-		while (XIicPs_BusIsBusy(&IicDev)) {}
-#else
-		if(2 != XIic_Send(IicDev.BaseAddress, slaveAddr, rgbSnd, 2, XIIC_STOP)){
-			strcpy(szErrDesc, "failed to write memory address");
-			goto lErrorExit;
-		}
 #endif
 
+	prate = PrateGet(slaveAddr, uWait);
+	if ( NULL == prate ) {
+		szErrDesc = "no free rate controller";
+		goto lErrorExit;
+	}
 
+	while ( cbRecv < cbRead ) {
 
 		cbTrans = cbRead - cbRecv;
 		if ( 32 < cbTrans ) {
 			cbTrans = 32;
 		}
 
-		/* The Linux/Zynq I2C controller places the stop condition on the bus
-		** after every call to a read or write function. The I2C controller
-		** of the platform MCU requires user code to respond to the stop
-		** condition and explicitly re-set the acknowledge bit in the
-		** control register before it will ACK another SLA+W or SLA+R
-		** request. If immediately call the read function after calling
-		** the write function then the MCU firmware may not have enough
-		** time to respond to the stop condition and set the acknowledge
-		** bit before the start condition and SLA+R is placed on the bus.
-		** In such cases the PMCU will NACK the read request. Testing has
-		** shown that a minimum of 40us is required in order to guarantee
-		** that the PMCU ack's SLA+R and that if we do not add a software
-		** delay here the Zynq I2C controller may place the next start
-		** condition and SLA+R too soon for the PMCU to respond. Therefore
-		** we must delay thread execution before calling the read function.
-		*/
-		//
+		ctry = 0;
+		while ( fTrue ) {
+
+			DpmProbe3(read__pace__start, slaveAddr, addrRead, ctry);
+			usTurnaround = RatePace(prate);
+			DpmProbe3(read__pace__done, slaveAddr, addrRead, ctry);
 
+			/* Transmit the memory address to the slave.
+			*/
+			rgbSnd[0] = (addrRead  >> 8);
+			rgbSnd[1] = addrRead & 0xFF;
 
+			cb = 0;
+			rateres = rateresBusy;
+			DpmProbe3(read__addr__start, slaveAddr, addrRead, 2);
+			sts = StsI2cSend(fdI2cDev, slaveAddr, rgbSnd, 2);
 #if defined(__linux__)
-		nanosleep(&tsWait, NULL);
-		cb = read(fdI2cDev, &(pbRead[cbRecv]), cbTrans);
-		if ( 0 >= cb ) {
-			sprintf(szErrDesc, "read failed after %d bytes", cbRecv);
-			goto lErrorExit;
-		}
-		cbRecv += cb;
-		addrRead += cb;
-#elif defined(PLATFORM_ZYNQ)
-		usleep(uWait);
-		// Receive function form the flash
-		if(XST_SUCCESS != XIicPs_MasterRecvPolled(&IicDev, &(pbRead[cbRecv]), cbTrans, slaveAddr)){
-			sprintf(szErrDesc, "read failed after %d bytes", cbRecv);
-			goto lErrorExit;
-		}
-		while (XIicPs_BusIsBusy(&IicDev)) {}
-		cbRecv += cbTrans;
-		addrRead += cbTrans;
+			usAddrDone = UsNow();
+#endif
+			DpmProbe4(read__addr__done, slaveAddr, addrRead, 2, sts);
+			if ( i2cstsOk != sts ) {
+				szErrDesc = "failed to write memory address";
+			}
+			else {
+				rateres = rateresNack;
+				/* The Linux/Zynq I2C controller places the stop condition
+				** on the bus after every call to a read or write function.
+				** The I2C controller of the platform MCU requires user code
+				** to respond to the stop condition and explicitly re-set
+				** the acknowledge bit in the control register before it
+				** will ACK another SLA+W or SLA+R request. If immediately
+				** call the read function after calling the write function
+				** then the MCU firmware may not have enough time to respond
+				** to the stop condition and set the acknowledge bit before
+				** the start condition and SLA+R is placed on the bus. In
+				** such cases the PMCU will NACK the read request. Testing
+				** has shown that a minimum of 40us is required in order to
+				** guarantee that the PMCU ack's SLA+R. The caller passes
+				** the minimum delay required by the device in uWait and the
+				** rate controller widens the delay whenever a read is
+				** NACKed.
+				*/
+				DpmProbe3(read__turnaround__start, slaveAddr, addrRead, usTurnaround);
+				DelayUs(usTurnaround);
+				DpmProbe3(read__turnaround__done, slaveAddr, addrRead, usTurnaround);
+
+				/* The delay may be stretched by the scheduler and by the
+				** probes, so the interval the slave saw is measured up to
+				** the start of the read. Without a clock the requested
+				** delay is the best estimate.
+				*/
+				DpmProbe3(read__data__start, slaveAddr, addrRead, cbTrans);
+#if defined(__linux__)
+				usHeld = (UINT32)(UsNow() - usAddrDone);
 #else
-		usleep(uWait);
-		cb = XIic_Recv(IicDev.BaseAddress, slaveAddr, &(pbRead[cbRecv]), cbTrans, XIIC_STOP);
-		if(0 >= cb){
-			sprintf(szErrDesc, "read failed after %d bytes", cbRecv);
-			goto lErrorExit;
-		}
-		cbRecv += cbTrans;
-		addrRead += cbTrans;
+				usHeld = usTurnaround;
 #endif
+				sts = StsI2cRecv(fdI2cDev, slaveAddr, &(pbRead[cbRecv]), cbTrans, &cb);
+				DpmProbe4(read__data__done, slaveAddr, addrRead, cb, sts);
+				if ( i2cstsOk != sts ) {
+					szErrDesc = "read failed";
+				}
+			}
+
+			if ( i2cstsOk == sts ) {
+				if ( cb < cbTrans ) {
+					RateDone(prate, rateresShort);
+					RateHeld(prate, usHeld, fFalse);
+				}
+				else {
+					RateDone(prate, rateresClean);
+					RateHeld(prate, usHeld, fTrue);
+				}
+				break;
+			}
+
+			/* The slave accepted the address write but not the read.
+			*/
+			if ( rateresBusy != rateres ) {
+				RateHeld(prate, usHeld, fFalse);
+			}
+
+			if ( i2cstsTimeout == sts ) {
+				RateTimedOut(prate);
+				sts = i2cstsNack;
+			}
+			if ( i2cstsBusError == sts ) {
+				sts = i2cstsNack;
+			}
+
+			if ( i2cstsNack != sts ) {
+				rateres = rateresError;
+			}
+			RateDone(prate, rateres);
+			if (( i2cstsNack != sts ) || ( ctryI2cMax <= ++ctry )) {
+				RateFailed(prate, rateres);
+				goto lErrorExit;
+			}
+		}
 
+		cbRecv += cb;
+		addrRead += cb;
 	}
 
+	RateRelease(prate);
+
 	if ( NULL != pcbRead ) {
 		*pcbRead = cbRecv;
 	}
 
+	DpmProbe4(read__return, slaveAddr, cbRead, cbRecv, fTrue);
+
 	return fTrue;
 
 lErrorExit:
 
+	if ( NULL != prate ) {
+		RateRelease(prate);
+	}
+
 	if ( NULL != pcbRead ) {
 		*pcbRead = cbRecv;
 	}
 
-	if ( dpmutilfVerbose ) {
-		printf("%s%s\n", szErr, szErrDesc);
-	}
+	DpmVerbose("ERROR: PmcuI2cRead - %s after %d bytes\n", szErrDesc, cbRecv);
+
+	DpmProbe4(read__return, slaveAddr, cbRead, cbRecv, fFalse);
 
 	return fFalse;
 }
@@ -399,32 +734,57 @@ lErrorExit:
 **      Platform MCU starting at the specified address. Write operations
 **      may be split into multiple transactions with a maximum of
 **      cbPmcuRxMax bytes being written during a single write operation.
+**
+**      Transactions are spaced by the rate controller of the slave. A
+**      transaction is retried only if the slave NACKed its address, as
+**      nothing has been written in that case, and never when writing the
+**      software reset register of the Platform MCU. USDT probes mark the
+**      pacing delay and the transfer of every attempt and the wait
+**      between transactions.
 */
 BOOL
 I2CHALWrite(int fdI2cDev, BYTE slaveAddr, WORD addrWrite, BYTE* pbWrite, BYTE cbWrite, INT32 cbDevRxMax, WORD* pcbWritten, INT32 uWait) {
 
-	ssize_t	cb;
-	BYTE	ib;
-	BYTE	cbTrans;
-	BYTE	cbSent;
-	BYTE	rgbSnd[32];
-	char	szErr[64];
-	char	szErrDesc[128];
+	I2CHAL_RATE*	prate;
+	BYTE			ib;
+	BYTE			cbTrans;
+	BYTE			cbSent;
+	BYTE			ctry;
+	BYTE			ctryMax;
+	BYTE			sts;
+	BYTE			rateres;
+	BYTE			rgbSnd[32];
+	const char*		szErrDesc;
 
 	cbSent = 0;
-	strcpy(szErr, "ERROR: PmcuI2cWrite - ");
-	szErrDesc[0] = '\0';
+	prate = NULL;
+	szErrDesc = "";
+
+	/* The first attempt to write the software reset register may have
+	** reset the Platform MCU even if it failed, so it's never repeated.
+	*/
+	ctryMax = ctryI2cMax;
+	if (( addrPlatformMcuI2c == slaveAddr ) && ( regaddrSoftwareReset == addrWrite )) {
+		ctryMax = 1;
+	}
+
+	DpmProbe3(write__entry, slaveAddr, addrWrite, cbWrite);
 
 	/* Inform the I2C driver of the slave address.
 	*/
 #if defined(__linux__)
-	struct timespec tsWait;
 	if ( 0 > ioctl(fdI2cDev, I2C_SLAVE, slaveAddr) ) {
-		sprintf(szErrDesc, "failed to set I2C slave address");
+		szErrDesc = "failed to set I2C slave address";
 		goto lErrorExit;
 	}
 #endif
 
+	prate = PrateGet(slaveAddr, 0);
+	if ( NULL == prate ) {
+		szErrDesc = "no free rate controller";
+		goto lErrorExit;
+	}
+
 	while ( cbSent < cbWrite ) {
 		/* Determine how many bytes to transfer to the Eclypse PMCU for
 		** this transaction.
@@ -447,58 +807,756 @@ I2CHALWrite(int fdI2cDev, BYTE slaveAddr, WORD addrWrite, BYTE* pbWrite, BYTE cb
 
 		/* Transmit the memory address and data to the slave.
 		*/
-#if defined(__linux__)
-		cb = write(fdI2cDev, rgbSnd, cbTrans);
-		if (cb != cbTrans ) {
-			sprintf(szErrDesc, "write failed after %d bytes", cbSent);
-			goto lErrorExit;
-		}
-#elif defined(PLATFORM_ZYNQ)
-		// Send the data to the flash
-		if(XST_SUCCESS != XIicPs_MasterSendPolled(&IicDev, rgbSnd, cbTrans, slaveAddr)){
-			sprintf(szErrDesc, "write failed after %d bytes", cbSent);
-			goto lErrorExit;
-		}
-		while (XIicPs_BusIsBusy(&IicDev)) {}
-#else
-		cb = XIic_Send(IicDev.BaseAddress, slaveAddr, rgbSnd, cbTrans, XIIC_STOP);
-		if (cb != cbTrans ) {
-			sprintf(szErrDesc, "write failed after %d bytes", cbSent);
-			goto lErrorExit;
+		ctry = 0;
+		while ( fTrue ) {
+			DpmProbe3(write__pace__start, slaveAddr, addrWrite, ctry);
+			RatePace(prate);
+			DpmProbe3(write__pace__done, slaveAddr, addrWrite, ctry);
+
+			/* The memory address and the data go out in the same bus
+			** transaction, so both phases share a single pair of probes.
+			*/
+			DpmProbe3(write__data__start, slaveAddr, addrWrite, cbTrans - 2);
+			sts = StsI2cSend(fdI2cDev, slaveAddr, rgbSnd, cbTrans);
+			DpmProbe4(write__data__done, slaveAddr, addrWrite, cbTrans - 2, sts);
+			if ( i2cstsOk == sts ) {
+				RateDone(prate, rateresClean);
+				break;
+			}
+
+			if ( i2cstsTimeout == sts ) {
+				RateTimedOut(prate);
+			}
+
+			rateres = ( i2cstsError != sts ) ? rateresBusy : rateresError;
+			RateDone(prate, rateres);
+			if (( i2cstsNack != sts ) || ( ctryMax <= ++ctry )) {
+				RateFailed(prate, rateres);
+				szErrDesc = "write failed";
+				goto lErrorExit;
+			}
 		}
-#endif
-
 
 		cbSent += (cbTrans-2);
 		addrWrite += (cbTrans-2);
 
 		if ( cbSent < cbWrite ) {
+			DpmProbe3(write__wait__start, slaveAddr, addrWrite, uWait);
 #if defined(__linux__)
-			tsWait.tv_sec = 1;
-			tsWait.tv_nsec = 0;
-			nanosleep(&tsWait, NULL);
+			DelayUs(1000000);
 #else
-			usleep(uWait);
+			DelayUs(uWait);
 #endif
-
+			DpmProbe3(write__wait__done, slaveAddr, addrWrite, uWait);
 		}
 	}
 
+	RateRelease(prate);
+
 	if ( NULL != pcbWritten ) {
 		*pcbWritten = cbSent;
 	}
 
+	DpmProbe4(write__return, slaveAddr, cbWrite, cbSent, fTrue);
+
 	return fTrue;
 
 lErrorExit:
 
+	if ( NULL != prate ) {
+		RateRelease(prate);
+	}
+
 	if ( NULL != pcbWritten ) {
 		*pcbWritten = cbSent;
 	}
 
-	if ( dpmutilfVerbose ) {
-		printf("%s%s\n", szErr, szErrDesc);
-	}
+	DpmVerbose("ERROR: PmcuI2cWrite - %s after %d bytes\n", szErrDesc, cbSent);
+
+	DpmProbe4(write__return, slaveAddr, cbWrite, cbSent, fFalse);
 
 	return fFalse;
 }
+
+/* ------------------------------------------------------------ */
+/***    StsI2cSend
+**
+**  Parameters:
+**  	fdI2cDev        - open file descriptor for underlying I2C device (linux only)
+**      slaveAddr		- slave address of the device
+**      pbSnd           - pointer to the bytes to transmit
+**      cbSnd           - number of bytes to transmit
+**
+**  Return Value:
+**      i2cstsOk, i2cstsNack if the slave didn't acknowledge its address,
+**      i2cstsBusError if the transaction failed after the address or
+**      the bus was lost, i2cstsTimeout if the bus is stuck, i2cstsError
+**      for any other failure
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function performs a single write transaction.
+*/
+static BYTE
+StsI2cSend(int fdI2cDev, BYTE slaveAddr, BYTE* pbSnd, BYTE cbSnd) {
+
+#if !defined(__linux__) && !defined(PLATFORM_ZYNQ)
+	unsigned	cb;
+#endif
+
+#if defined(__linux__)
+	(void)slaveAddr;
+	if ( cbSnd != write(fdI2cDev, pbSnd, cbSnd) ) {
+		return StsFromErrno();
+	}
+#elif defined(PLATFORM_ZYNQ)
+	/* The PS driver doesn't report which byte was NACKed.
+	*/
+	if ( XST_SUCCESS != XIicPs_MasterSendPolled(&IicDev, pbSnd, cbSnd, slaveAddr) ) {
+		return i2cstsBusError;
+	}
+	while ( XIicPs_BusIsBusy(&IicDev) ) {}
+#else
+	cb = XIic_Send(IicDev.BaseAddress, slaveAddr, pbSnd, cbSnd, XIIC_STOP);
+	if ( 0 == cb ) {
+		return i2cstsNack;
+	}
+	if ( cbSnd != cb ) {
+		return i2cstsBusError;
+	}
+#endif
+
+	return i2cstsOk;
+}
+
+/* ------------------------------------------------------------ */
+/***    StsI2cRecv
+**
+**  Parameters:
+**  	fdI2cDev        - open file descriptor for underlying I2C device (linux only)
+**      slaveAddr		- slave address of the device
+**      pbRecv          - pointer to a buffer to receive data
+**      cbRecv          - number of bytes to read
+**      pcbRecv         - pointer to variable to receive the number of
+**                        bytes read
+**
+**  Return Value:
+**      i2cstsOk if at least one byte was read, i2cstsNack if the slave
+**      didn't respond (or the bus was busy), i2cstsError for any other
+**      failure
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function performs a single read transaction.
+*/
+static BYTE
+StsI2cRecv(int fdI2cDev, BYTE slaveAddr, BYTE* pbRecv, BYTE cbRecv, ssize_t* pcbRecv) {
+
+	ssize_t	cb;
+
+#if defined(__linux__)
+	(void)slaveAddr;
+	cb = read(fdI2cDev, pbRecv, cbRecv);
+	if ( 0 > cb ) {
+		return StsFromErrno();
+	}
+#elif defined(PLATFORM_ZYNQ)
+	if ( XST_SUCCESS != XIicPs_MasterRecvPolled(&IicDev, pbRecv, cbRecv, slaveAddr) ) {
+		return i2cstsNack;
+	}
+	while ( XIicPs_BusIsBusy(&IicDev) ) {}
+	cb = cbRecv;
+#else
+	cb = XIic_Recv(IicDev.BaseAddress, slaveAddr, pbRecv, cbRecv, XIIC_STOP);
+#endif
+
+	if ( 0 >= cb ) {
+		return i2cstsNack;
+	}
+
+	*pcbRecv = cb;
+
+	return i2cstsOk;
+}
+
+#if defined(__linux__)
+/* ------------------------------------------------------------ */
+/***    StsFromErrno
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      status corresponding to the errno of a failed transaction
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function classifies the failure of an i2c-dev read or write.
+**      Bus drivers report a NACK of the slave address as ENXIO, a NACK
+**      that may have followed some data as EREMOTEIO or EIO, a lost
+**      arbitration as EAGAIN and a stuck bus as ETIMEDOUT. Drivers that
+**      report an address NACK as EREMOTEIO or EIO only lose the retry
+**      of writes.
+*/
+static BYTE
+StsFromErrno() {
+
+	switch ( errno ) {
+		case ENXIO:
+			return i2cstsNack;
+		case EREMOTEIO:
+		case EIO:
+		case EAGAIN:
+			return i2cstsBusError;
+		case ETIMEDOUT:
+			return i2cstsTimeout;
+		default:
+			return i2cstsError;
+	}
+}
+#endif
+
+/* ------------------------------------------------------------ */
+/***    PrateFind
+**
+**  Parameters:
+**      slaveAddr       - slave address of the device
+**
+**  Return Value:
+**      pointer to the rate controller of the slave, NULL if none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function looks up the rate controller of a slave. The caller
+**      must hold the rate lock.
+*/
+static I2CHAL_RATE*
+PrateFind(BYTE slaveAddr) {
+
+	BYTE	irate;
+
+	for ( irate = 0; irate < crateMax; irate++ ) {
+		if (( rgrate[irate].fUsed ) && ( rgrate[irate].addr == slaveAddr )) {
+			return &rgrate[irate];
+		}
+	}
+
+	return NULL;
+}
+
+/* ------------------------------------------------------------ */
+/***    PrateGet
+**
+**  Parameters:
+**      slaveAddr       - slave address of the device
+**      usFloor         - minimum turnaround delay required by the device,
+**                        0 if the transaction has no turnaround
+**
+**  Return Value:
+**      pointer to the rate controller of the slave, NULL if every
+**      controller is in use by a transaction
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function claims the rate controller of a slave for a
+**      transaction, creating it if this is the first transaction
+**      addressed to the slave. A new controller starts with the
+**      conservative turnaround delay that the HAL has always used and
+**      no spacing between transactions. The caller must release the
+**      controller with RateRelease.
+**
+**      The minimum turnaround of a slave is the largest minimum passed
+**      for it, so that writes, which pass none, don't lower the
+**      turnaround of the reads that follow them.
+**
+**      When every controller is taken the least recently used one that
+**      no transaction is using is discarded and reused, so the
+**      controllers of busy slaves keep their learned delays. The
+**      transaction fails if there is none, which takes more than
+**      crateMax transactions to different slaves at the same time.
+*/
+static I2CHAL_RATE*
+PrateGet(BYTE slaveAddr, UINT32 usFloor) {
+
+	I2CHAL_RATE*	prate;
+	BYTE			irate;
+
+	RateLock();
+
+	prate = PrateFind(slaveAddr);
+	if ( NULL == prate ) {
+		for ( irate = 0; irate < crateMax; irate++ ) {
+			if ( 0 < rgrate[irate].cref ) {
+				continue;
+			}
+			if ( ! rgrate[irate].fUsed ) {
+				prate = &rgrate[irate];
+				break;
+			}
+			if (( NULL == prate ) || ( rgrate[irate].seqUse < prate->seqUse )) {
+				prate = &rgrate[irate];
+			}
+		}
+
+		if ( NULL == prate ) {
+			RateUnlock();
+			DpmPrintf("ERROR: all %d I2C rate controllers are in use, transaction to 0x%02X refused\n", crateMax, slaveAddr);
+			return NULL;
+		}
+
+		if ( prate->fUsed ) {
+			DpmVerbose("I2C rate controller of 0x%02X reused for 0x%02X\n", prate->addr, slaveAddr);
+		}
+
+		memset(prate, 0, sizeof(I2CHAL_RATE));
+		prate->fUsed = fTrue;
+		prate->addr = slaveAddr;
+		prate->stats.usTurnaround = ( usTurnaroundInit > usFloor ) ? usTurnaroundInit : usFloor;
+	}
+
+	if ( prate->fFloor ) {
+		usFloor = prate->usFloor;
+	}
+	else if ( usFloor < prate->stats.usTurnaroundMin ) {
+		usFloor = prate->stats.usTurnaroundMin;
+	}
+
+	prate->stats.usTurnaroundMin = usFloor;
+	if ( prate->stats.usTurnaround < usFloor ) {
+		prate->stats.usTurnaround = usFloor;
+	}
+
+	prate->seqUse = ++seqRateUse;
+	prate->cref++;
+
+	RateUnlock();
+
+	return prate;
+}
+
+/* ------------------------------------------------------------ */
+/***    RateRelease
+**
+**  Parameters:
+**      prate           - rate controller claimed by PrateGet
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function releases a rate controller at the end of a
+**      transaction, so that it may be reused for another slave.
+*/
+static void
+RateRelease(I2CHAL_RATE* prate) {
+
+	RateLock();
+	prate->cref--;
+	RateUnlock();
+}
+
+/* ------------------------------------------------------------ */
+/***    RatePace
+**
+**  Parameters:
+**      prate           - rate controller of the slave
+**
+**  Return Value:
+**      turnaround delay to use for the transaction, in microseconds
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function waits until the spacing chosen by the rate
+**      controller has elapsed since the previous transaction addressed
+**      to the slave and counts the transaction.
+*/
+static UINT32
+RatePace(I2CHAL_RATE* prate) {
+
+	UINT32	usGap;
+	UINT32	usTurnaround;
+	UINT64	usLast;
+#if defined(__linux__)
+	UINT64	usNow;
+#endif
+
+	RateLock();
+	prate->stats.cTx++;
+	usGap = prate->stats.usGap;
+	usTurnaround = prate->stats.usTurnaround;
+	usLast = prate->usLast;
+	RateUnlock();
+
+	if ( 0 < usGap ) {
+#if defined(__linux__)
+		usNow = UsNow();
+		if ( usNow < usLast + usGap ) {
+			DelayUs(usLast + usGap - usNow);
+		}
+#else
+		(void)usLast;
+		DelayUs(usGap);
+#endif
+	}
+
+	return usTurnaround;
+}
+
+/* ------------------------------------------------------------ */
+/***    RateDone
+**
+**  Parameters:
+**      prate           - rate controller of the slave
+**      rateres         - outcome of the transaction
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function feeds the outcome of a transaction to the rate
+**      controller of the slave. Both knobs of the controller are
+**      additive-increase/multiplicative-decrease:
+**
+**      - A NACK of the address phase means the slave is busy. The rate
+**        of transactions is halved, that is the spacing between them is
+**        doubled, and every clean transaction adds hzGapInc back to the
+**        rate until no spacing is required.
+**      - A NACK of the data phase, or a short read, means the slave
+**        wasn't ready to be read. The turnaround delay is doubled and
+**        every ccleanTighten clean transactions shorten it by
+**        usTurnaroundDec, down to the minimum required by the device.
+*/
+static void
+RateDone(I2CHAL_RATE* prate, BYTE rateres) {
+
+	I2CHAL_RATE_STATS*	pstats;
+	UINT32				hz;
+
+	RateLock();
+
+	pstats = &prate->stats;
+
+	switch ( rateres ) {
+		case rateresClean:
+			if ( 0 < pstats->usGap ) {
+				hz = (1000000 / pstats->usGap) + hzGapInc;
+				pstats->usGap = 1000000 / hz;
+				if ( usGapInc > pstats->usGap ) {
+					pstats->usGap = 0;
+				}
+			}
+			prate->cClean++;
+			if ( ccleanTighten <= prate->cClean ) {
+				prate->cClean = 0;
+				if ( pstats->usTurnaround >= pstats->usTurnaroundMin + usTurnaroundDec ) {
+					pstats->usTurnaround -= usTurnaroundDec;
+				}
+				else {
+					pstats->usTurnaround = pstats->usTurnaroundMin;
+				}
+			}
+			break;
+
+		case rateresBusy:
+			pstats->cNack++;
+			pstats->cRetry++;
+			prate->cClean = 0;
+			pstats->usGap = ( usGapInc > pstats->usGap ) ? usGapInc : 2 * pstats->usGap;
+			if ( usGapMax < pstats->usGap ) {
+				pstats->usGap = usGapMax;
+			}
+			break;
+
+		case rateresShort:
+		case rateresNack:
+			if ( rateresShort == rateres ) {
+				pstats->cShort++;
+			}
+			else {
+				pstats->cNack++;
+				pstats->cRetry++;
+			}
+			prate->cClean = 0;
+			pstats->usTurnaround = 2 * pstats->usTurnaround;
+			if ( pstats->usTurnaround < pstats->usTurnaroundMin + usTurnaroundInc ) {
+				pstats->usTurnaround = pstats->usTurnaroundMin + usTurnaroundInc;
+			}
+			if ( usTurnaroundMax < pstats->usTurnaround ) {
+				pstats->usTurnaround = usTurnaroundMax;
+			}
+			break;
+
+		default:
+			prate->cClean = 0;
+			break;
+	}
+
+#if defined(__linux__)
+	prate->usLast = UsNow();
+#endif
+
+	RateUnlock();
+}
+
+/* ------------------------------------------------------------ */
+/***    RateFailed
+**
+**  Parameters:
+**      prate           - rate controller of the slave
+**      rateres         - result of the last attempt, as fed to RateDone
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function counts a transaction that failed after all of its
+**      retries. A last attempt that was NACKed or found the slave busy
+**      was counted as a retry by RateDone, although it isn't retried.
+*/
+static void
+RateFailed(I2CHAL_RATE* prate, BYTE rateres) {
+
+	RateLock();
+	prate->stats.cFail++;
+	if (( rateresBusy == rateres ) || ( rateresNack == rateres )) {
+		prate->stats.cRetry--;
+	}
+	RateUnlock();
+}
+
+/* ------------------------------------------------------------ */
+/***    RateHeld
+**
+**  Parameters:
+**      prate           - rate controller of the slave
+**      usHeld          - measured interval between the address write
+**                        and the read, in microseconds
+**      fClean          - fTrue if the slave answered the read in full
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function counts a read as clean or failed at the level of
+**      its turnaround interval, and updates the lowest level from which
+**      every read was answered in full. Without DPMUTIL_CFG_RATE only
+**      the clean reads are counted. A single read that held at a
+**      tight interval says little on its own, so a level only counts as
+**      clean when neither it nor any longer level has seen a failure.
+*/
+static void
+RateHeld(I2CHAL_RATE* prate, UINT32 usHeld, BOOL fClean) {
+
+#if DPMUTIL_CFG_RATE
+	BYTE	ilevel;
+#endif
+
+	RateLock();
+
+	if ( fClean ) {
+		prate->stats.usHeldLast = usHeld;
+		prate->stats.cHeld++;
+	}
+
+#if DPMUTIL_CFG_RATE
+	ilevel = IlevelHeld(usHeld);
+	if ( fClean ) {
+		prate->stats.rgcHeldClean[ilevel]++;
+	}
+	else {
+		prate->stats.rgcHeldFail[ilevel]++;
+	}
+
+	prate->stats.usHeldClean = usHeldNone;
+	ilevel = clevelHeld;
+	while ( 0 < ilevel ) {
+		ilevel--;
+		if ( 0 < prate->stats.rgcHeldFail[ilevel] ) {
+			break;
+		}
+		if ( 0 < prate->stats.rgcHeldClean[ilevel] ) {
+			prate->stats.usHeldClean = I2CHALHeldLevel(ilevel);
+		}
+	}
+#endif
+
+	RateUnlock();
+}
+
+#if DPMUTIL_CFG_RATE
+/* ------------------------------------------------------------ */
+/***    IlevelHeld
+**
+**  Parameters:
+**      usHeld          - measured turnaround interval in microseconds
+**
+**  Return Value:
+**      level the interval is counted at
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns the level of a turnaround interval, see
+**      I2CHALHeldLevel.
+*/
+static BYTE
+IlevelHeld(UINT32 usHeld) {
+
+	UINT32	ilevel;
+
+	if ( usHeld < clevelHeldFine * usHeldFine ) {
+		return usHeld / usHeldFine;
+	}
+
+	ilevel = clevelHeldFine + (usHeld - clevelHeldFine * usHeldFine) / usHeldCoarse;
+	if ( clevelHeld <= ilevel ) {
+		ilevel = clevelHeld - 1;
+	}
+
+	return (BYTE)ilevel;
+}
+#endif
+
+/* ------------------------------------------------------------ */
+/***    RateTimedOut
+**
+**  Parameters:
+**      prate           - rate controller of the slave
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function counts a transaction that timed out. The caller
+**      then feeds it to the rate controller as a NACK.
+*/
+static void
+RateTimedOut(I2CHAL_RATE* prate) {
+
+	RateLock();
+	prate->stats.cTimeout++;
+	RateUnlock();
+}
+
+/* ------------------------------------------------------------ */
+/***    RateLock / RateUnlock
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      These functions serialize access to the rate controllers on
+**      linux, where several threads may share the HAL.
+*/
+static void
+RateLock() {
+
+#if defined(__linux__)
+	pthread_mutex_lock(&mtxRate);
+#endif
+}
+
+static void
+RateUnlock() {
+
+#if defined(__linux__)
+	pthread_mutex_unlock(&mtxRate);
+#endif
+}
+
+/* ------------------------------------------------------------ */
+/***    DelayUs
+**
+**  Parameters:
+**      us              - number of microseconds to wait
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function suspends the calling thread for the specified
+**      number of microseconds.
+*/
+static void
+DelayUs(UINT32 us) {
+
+#if defined(__linux__)
+	struct timespec	tsWait;
+#endif
+
+	if ( 0 == us ) {
+		return;
+	}
+
+#if defined(__linux__)
+	tsWait.tv_sec = us / 1000000;
+	tsWait.tv_nsec = (us % 1000000) * 1000;
+	nanosleep(&tsWait, NULL);
+#else
+	usleep(us);
+#endif
+}
+
+#if defined(__linux__)
+/* ------------------------------------------------------------ */
+/***    UsNow
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      current value of the monotonic clock in microseconds
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function reads the monotonic clock.
+*/
+static UINT64
+UsNow() {
+
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((UINT64)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+#endif
@@ -25,6 +25,7 @@
 #define I2CHAL_H_
 
 #include "stdtypes.h"
+#include "dpmutilcfg.h"
 
 #if !defined(__linux__)
 #include "xparameters.h"
@@ -52,16 +53,66 @@
 #define cchDeviceNameMax	64
 #endif
 
+/* Define the levels that measured turnaround intervals are counted at,
+** see I2CHAL_RATE_STATS. The first clevelHeldFine levels are usHeldFine
+** wide and the rest usHeldCoarse wide, with the last level taking every
+** longer interval. I2CHALHeldLevel returns the start of a level.
+*/
+#define clevelHeld			32
+#define clevelHeldFine		16
+#define usHeldFine			8
+#define usHeldCoarse		128
+#define usHeldNone			0xFFFFFFFF
+
+/* ------------------------------------------------------------ */
+/*                  General Type Declarations                   */
+/* ------------------------------------------------------------ */
+
+/* Transaction counters and current delays of the rate controller that
+** the HAL keeps for each slave. Delays are in microseconds. The held
+** intervals are measured on the bus side of the turnaround delay, from
+** the end of the address write to the start of the read, and may be
+** longer than the delay requested. A read counts as failed at the
+** level of its interval when the slave NACKed it or cut it short after
+** accepting the address write.
+*/
+typedef struct {
+	UINT32	cTx;                // transactions attempted
+	UINT32	cNack;              // transactions NACKed, including retries
+	UINT32	cShort;             // reads that returned fewer bytes than requested
+	UINT32	cRetry;             // transactions retried after a NACK
+	UINT32	cFail;              // transactions that failed after all retries
+	UINT32	cTimeout;           // transactions that timed out, also counted as NACKed
+	UINT32	usTurnaround;       // delay between address write and read
+	UINT32	usTurnaroundMin;    // minimum delay required by the device
+	UINT32	usGap;              // spacing between transactions
+	UINT32	cHeld;              // reads answered in full, one per 32 byte chunk
+	UINT32	usHeldLast;         // measured address to read interval of the last one
+#if DPMUTIL_CFG_RATE
+	UINT32	usHeldClean;        // start of the lowest level from which no read failed,
+	                            // usHeldNone if one failed at the last level
+	UINT32	rgcHeldClean[clevelHeld];   // reads answered in full, per level
+	UINT32	rgcHeldFail[clevelHeld];    // reads that failed, per level
+#endif
+} I2CHAL_RATE_STATS;
+
 /* ------------------------------------------------------------ */
 /*                  Procedure Declarations                      */
 /* ------------------------------------------------------------ */
 #if defined(__linux__)
 int I2CHALOpenI2cController();
+void I2CHALBindController(int fdI2cDev);
 #else
 BOOL I2CHALInit(UINT32 deviceID);
 #endif
 BOOL I2CHALRead(int fdI2cDev, BYTE slaveAddr, WORD addrRead, BYTE* pbRead, BYTE cbRead, WORD* pcbRead, UINT32 uWait);
 BOOL I2CHALWrite(int fdI2cDev, BYTE slaveAddr, WORD addrWrite, BYTE* pbWrite, BYTE cbWrite, INT32 cbDevRxMax, WORD* pcbWritten, INT32 uWait);
+BOOL I2CHALGetRateStats(BYTE slaveAddr, I2CHAL_RATE_STATS* pstats);
+void I2CHALResetRate(BYTE slaveAddr);
+void I2CHALSetTurnaroundFloor(BYTE slaveAddr, UINT32 usFloor);
+#if DPMUTIL_CFG_RATE
+UINT32 I2CHALHeldLevel(BYTE ilevel);
+#endif
 
 
 #endif
@@ -0,0 +1,818 @@
+/************************************************************************/
+/*                                                                      */
+/*  I2CSim.c - Simulated Platform MCU / SYZYGY I2C bus implementation   */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This source file contains the implementation of a simulated I2C bus */
+/*  that replaces the open, ioctl, read and write calls made by the     */
+/*  linux HAL when it's built with I2CHAL_SIM defined.                  */
+/*                                                                      */
+/*  Each simulated device exposes a 64KB memory with the same register  */
+/*  pointer semantics as the Platform MCU and SYZYGY pod firmware: a    */
+/*  two byte write sets the pointer, longer writes store data starting  */
+/*  at the pointer and reads return data starting at the pointer. The   */
+/*  pointer auto-increments. Transactions addressed to a slave that     */
+/*  isn't present fail with ENXIO, the same way a NACK does.            */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#if defined(__linux__) && defined(I2CHAL_SIM)
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <linux/i2c-dev.h>
+#include "stdtypes.h"
+#include "PlatformMCU.h"
+#include "syzygy.h"
+#include "ZmodCal.h"
+#include "ZmodADC.h"
+#include "ZmodDAC.h"
+#include "I2CSim.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+#define cbSimMem			0x10000
+#define csimdev				3
+#define cfdSimMax			1024
+
+#define pdidSimPmcu			0x00000001
+#define pdidSimZmodADC		((prodZmodADC << 20) | 0x00001)
+#define pdidSimZmodDAC		((prodZmodDAC << 20) | 0x00001)
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+typedef struct {
+	BYTE	addrI2c;
+	WORD	addrPtr;
+	UINT32	usTurnaround;   // minimum delay between address write and read
+	UINT32	usBusy;         // time spent busy after a data write
+	UINT64	usAddrWritten;  // time of the last address write
+	UINT64	usBusyUntil;    // end of the current busy period
+	UINT32	cNack;          // transactions NACKed
+	int		errFault;       // error returned by injected faults
+	UINT32	cFault;         // number of transactions left to fail
+	BYTE	rgbMem[cbSimMem];
+} I2CSIM_DEV;
+
+/* ------------------------------------------------------------ */
+/*              Global Variables                                */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static pthread_mutex_t	mtxSim = PTHREAD_MUTEX_INITIALIZER;
+static BOOL				fSimInit = fFalse;
+static I2CSIM_DEV		rgsimdev[csimdev];
+static BYTE				rgaddrSlave[cfdSimMax];
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static void			SimInit();
+static void			SimInitPmcu(I2CSIM_DEV* pdev);
+static void			SimInitPod(I2CSIM_DEV* pdev, DWORD pdid, const char* szProduct, const char* szModel);
+static void			SimPmcuWritten(I2CSIM_DEV* pdev, WORD addrFirst, WORD cb);
+static void			SimPutWord(BYTE* pb, WORD w);
+static I2CSIM_DEV*	PsimdevFromFd(int fd);
+static I2CSIM_DEV*	PsimdevFromAddr(BYTE addrI2c);
+static UINT64		UsSimNow();
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/***    I2CSimOpen
+**
+**  Parameters:
+**      szPath          - path of the I2C device node (ignored)
+**      flags           - open flags (ignored)
+**
+**  Return Value:
+**      file descriptor representing the simulated bus, less than zero
+**      on failure
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns a real file descriptor (opened on
+**      /dev/null) so that callers may close it as usual.
+*/
+int
+I2CSimOpen(const char* szPath, int flags) {
+
+	int		fd;
+
+	(void)szPath;
+	(void)flags;
+
+	pthread_mutex_lock(&mtxSim);
+	if ( ! fSimInit ) {
+		SimInit();
+		fSimInit = fTrue;
+	}
+	pthread_mutex_unlock(&mtxSim);
+
+	fd = open("/dev/null", O_RDWR);
+	if (( 0 <= fd ) && ( cfdSimMax <= fd )) {
+		close(fd);
+		errno = EMFILE;
+		return -1;
+	}
+
+	if ( 0 <= fd ) {
+		rgaddrSlave[fd] = 0;
+	}
+
+	return fd;
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CSimIoctl
+**
+**  Parameters:
+**      fd              - file descriptor returned by I2CSimOpen
+**      req             - ioctl request, only I2C_SLAVE is supported
+**      ...             - slave address
+**
+**  Return Value:
+**      0 for success, -1 otherwise
+**
+**  Errors:
+**      EINVAL for unsupported requests or invalid descriptors
+**
+**  Description:
+**      This function selects the slave addressed by subsequent reads
+**      and writes on the specified file descriptor.
+*/
+int
+I2CSimIoctl(int fd, unsigned long req, ...) {
+
+	va_list	args;
+	long	addr;
+
+	if (( I2C_SLAVE != req ) || ( 0 > fd ) || ( cfdSimMax <= fd )) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	va_start(args, req);
+	addr = va_arg(args, long);
+	va_end(args);
+
+	rgaddrSlave[fd] = (BYTE)addr;
+
+	return 0;
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CSimWrite
+**
+**  Parameters:
+**      fd              - file descriptor returned by I2CSimOpen
+**      pvBuf           - register address (2 bytes, MSB first) followed
+**                        by any data to write
+**      cb              - number of bytes in the buffer
+**
+**  Return Value:
+**      number of bytes written, -1 otherwise
+**
+**  Errors:
+**      ENXIO if no device responds at the selected slave address
+**
+**  Description:
+**      This function performs a write transaction on the simulated bus.
+*/
+ssize_t
+I2CSimWrite(int fd, const void* pvBuf, size_t cb) {
+
+	I2CSIM_DEV*	pdev;
+	const BYTE*	pb;
+	WORD		addrFirst;
+	size_t		ib;
+	UINT64		usNow;
+
+	pb = (const BYTE*)pvBuf;
+
+	pthread_mutex_lock(&mtxSim);
+
+	pdev = PsimdevFromFd(fd);
+	if (( NULL == pdev ) || ( 2 > cb )) {
+		pthread_mutex_unlock(&mtxSim);
+		errno = ENXIO;
+		return -1;
+	}
+
+	if ( 0 < pdev->cFault ) {
+		pdev->cFault--;
+		pthread_mutex_unlock(&mtxSim);
+		errno = pdev->errFault;
+		return -1;
+	}
+
+	usNow = UsSimNow();
+	if ( usNow < pdev->usBusyUntil ) {
+		pdev->cNack++;
+		pthread_mutex_unlock(&mtxSim);
+		errno = ENXIO;
+		return -1;
+	}
+
+	pdev->usAddrWritten = usNow;
+	if ( 2 < cb ) {
+		pdev->usBusyUntil = usNow + pdev->usBusy;
+	}
+
+	pdev->addrPtr = (pb[0] << 8) | pb[1];
+	addrFirst = pdev->addrPtr;
+	for ( ib = 2; ib < cb; ib++ ) {
+		pdev->rgbMem[pdev->addrPtr] = pb[ib];
+		pdev->addrPtr++;
+	}
+
+	if (( addrPlatformMcuI2c == pdev->addrI2c ) && ( 2 < cb )) {
+		SimPmcuWritten(pdev, addrFirst, cb - 2);
+	}
+
+	pthread_mutex_unlock(&mtxSim);
+
+	return cb;
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CSimRead
+**
+**  Parameters:
+**      fd              - file descriptor returned by I2CSimOpen
+**      pvBuf           - pointer to a buffer to receive data
+**      cb              - number of bytes to read
+**
+**  Return Value:
+**      number of bytes read, -1 otherwise
+**
+**  Errors:
+**      ENXIO if no device responds at the selected slave address
+**
+**  Description:
+**      This function performs a read transaction on the simulated bus.
+*/
+ssize_t
+I2CSimRead(int fd, void* pvBuf, size_t cb) {
+
+	I2CSIM_DEV*	pdev;
+	BYTE*		pb;
+	size_t		ib;
+	UINT64		usNow;
+
+	pb = (BYTE*)pvBuf;
+
+	pthread_mutex_lock(&mtxSim);
+
+	pdev = PsimdevFromFd(fd);
+	if ( NULL == pdev ) {
+		pthread_mutex_unlock(&mtxSim);
+		errno = ENXIO;
+		return -1;
+	}
+
+	if ( 0 < pdev->cFault ) {
+		pdev->cFault--;
+		pthread_mutex_unlock(&mtxSim);
+		errno = pdev->errFault;
+		return -1;
+	}
+
+	/* The device NACKs SLA+R while it's busy and when the read follows
+	** the address write too closely.
+	*/
+	usNow = UsSimNow();
+	if (( usNow < pdev->usBusyUntil ) || ( usNow < pdev->usAddrWritten + pdev->usTurnaround )) {
+		pdev->cNack++;
+		pthread_mutex_unlock(&mtxSim);
+		errno = ENXIO;
+		return -1;
+	}
+
+	for ( ib = 0; ib < cb; ib++ ) {
+		pb[ib] = pdev->rgbMem[pdev->addrPtr];
+		pdev->addrPtr++;
+	}
+
+	pthread_mutex_unlock(&mtxSim);
+
+	return cb;
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CSimSetTiming
+**
+**  Parameters:
+**      addrI2c         - I2C address of the simulated device
+**      usTurnaround    - minimum delay the device requires between an
+**                        address write and the following read
+**      usBusy          - time the device spends busy, NACKing every
+**                        transaction, after a write that carries data
+**
+**  Return Value:
+**      fTrue for success, fFalse if there is no such device
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function sets the timing constraints of a simulated device.
+*/
+BOOL
+I2CSimSetTiming(BYTE addrI2c, UINT32 usTurnaround, UINT32 usBusy) {
+
+	I2CSIM_DEV*	pdev;
+
+	pthread_mutex_lock(&mtxSim);
+	if ( ! fSimInit ) {
+		SimInit();
+		fSimInit = fTrue;
+	}
+
+	pdev = PsimdevFromAddr(addrI2c);
+	if ( NULL != pdev ) {
+		pdev->usTurnaround = usTurnaround;
+		pdev->usBusy = usBusy;
+	}
+	pthread_mutex_unlock(&mtxSim);
+
+	return ( NULL != pdev ) ? fTrue : fFalse;
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CSimSetFault
+**
+**  Parameters:
+**      addrI2c         - I2C address of the simulated device
+**      errFault        - errno value reported by the failing transactions
+**      cFault          - number of read or write transactions to fail,
+**                        0 to stop failing
+**
+**  Return Value:
+**      fTrue for success, fFalse if there is no such device
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function makes the next transactions addressed to a
+**      simulated device fail, for example with ENXIO to emulate a pod
+**      that has stopped responding or with EIO or ETIMEDOUT to emulate
+**      a bus error. Failed transactions have no effect on the device.
+*/
+BOOL
+I2CSimSetFault(BYTE addrI2c, int errFault, UINT32 cFault) {
+
+	I2CSIM_DEV*	pdev;
+
+	pthread_mutex_lock(&mtxSim);
+	if ( ! fSimInit ) {
+		SimInit();
+		fSimInit = fTrue;
+	}
+
+	pdev = PsimdevFromAddr(addrI2c);
+	if ( NULL != pdev ) {
+		pdev->errFault = errFault;
+		pdev->cFault = cFault;
+	}
+	pthread_mutex_unlock(&mtxSim);
+
+	return ( NULL != pdev ) ? fTrue : fFalse;
+}
+
+/* ------------------------------------------------------------ */
+/***    I2CSimGetNackCount
+**
+**  Parameters:
+**      addrI2c         - I2C address of the simulated device
+**
+**  Return Value:
+**      number of transactions the device has NACKed
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function returns the number of transactions NACKed by a
+**      simulated device because of its timing constraints.
+*/
+UINT32
+I2CSimGetNackCount(BYTE addrI2c) {
+
+	I2CSIM_DEV*	pdev;
+	UINT32		cNack;
+
+	pthread_mutex_lock(&mtxSim);
+	pdev = PsimdevFromAddr(addrI2c);
+	cNack = ( NULL != pdev ) ? pdev->cNack : 0;
+	pthread_mutex_unlock(&mtxSim);
+
+	return cNack;
+}
+
+/* ------------------------------------------------------------ */
+/***    SimInit
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function populates the memory of every simulated device.
+*/
+static void
+SimInit() {
+
+	memset(rgsimdev, 0, sizeof(rgsimdev));
+
+	SimInitPmcu(&rgsimdev[0]);
+	SimInitPod(&rgsimdev[1], pdidSimZmodADC, "Zmod ADC 1410-105", "ZmodADC");
+	rgsimdev[1].addrI2c = addrSimPodA;
+	SimInitPod(&rgsimdev[2], pdidSimZmodDAC, "Zmod DAC 1411-125", "ZmodDAC");
+	rgsimdev[2].addrI2c = addrSimPodB;
+
+	/* The Platform MCU needs at least 40us to re-arm its acknowledge bit
+	** after the stop condition that ends the address write. Both timing
+	** parameters of the Platform MCU may be overridden from the
+	** environment so that HAL behaviour can be exercised under pressure.
+	*/
+	rgsimdev[0].usTurnaround = 40;
+	if ( NULL != getenv("DPMUTIL_SIM_PMCU_TURNAROUND") ) {
+		rgsimdev[0].usTurnaround = strtoul(getenv("DPMUTIL_SIM_PMCU_TURNAROUND"), NULL, 0);
+	}
+	if ( NULL != getenv("DPMUTIL_SIM_PMCU_BUSY") ) {
+		rgsimdev[0].usBusy = strtoul(getenv("DPMUTIL_SIM_PMCU_BUSY"), NULL, 0);
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    SimInitPmcu
+**
+**  Parameters:
+**      pdev            - simulated device to initialize
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function populates the registers of an Eclypse Z7 style
+**      Platform MCU: two SmartVIO ports with their own VADJ supply, one
+**      5V0 and one 3V3 supply, one temperature probe and one fan.
+*/
+static void
+SimInitPmcu(I2CSIM_DEV* pdev) {
+
+	BYTE*	pb;
+	BYTE	iport;
+
+	pdev->addrI2c = addrPlatformMcuI2c;
+	pb = pdev->rgbMem;
+
+	pb[regaddrPDID + 0] = pdidSimPmcu & 0xFF;
+	pb[regaddrPDID + 1] = (pdidSimPmcu >> 8) & 0xFF;
+	pb[regaddrPDID + 2] = (pdidSimPmcu >> 16) & 0xFF;
+	pb[regaddrPDID + 3] = (pdidSimPmcu >> 24) & 0xFF;
+	SimPutWord(&pb[regaddrFirmwareVersion], 0x0102);
+	SimPutWord(&pb[regaddrConfigurationVersion], 0x0100);
+	SimPutWord(&pb[regaddrPlatformConfig], 0x0008);
+
+	pb[regaddrTempProbeCount] = 1;
+	pb[regaddrFanCount] = 1;
+	pb[regaddr5v0GroupCount] = 1;
+	pb[regaddr3v3GroupCount] = 1;
+	pb[regaddrVadjGroupCount] = 2;
+	pb[regaddrPortCount] = 2;
+
+	pb[regaddrTemp1Attributes] = 0x01 | (tlocationFpgaCpu1 << 1) | (tformatDegCFixedPoint << 4);
+	SimPutWord(&pb[regaddrTemp1], 45 * 256 + 128);
+
+	pb[regaddrFan1Capabilities] = 0x0F;
+	pb[regaddrFan1Config] = fancfgEnable | (fancfgAutoSpeed << 1) | (fancfgTempProbe1 << 3);
+	SimPutWord(&pb[regaddrFan1Rpm], 3000);
+
+	SimPutWord(&pb[regaddr5v0ACurrentAllowed], 2000);
+	SimPutWord(&pb[regaddr5v0ACurrentRequested], 400);
+	SimPutWord(&pb[regaddr3v3ACurrentAllowed], 2000);
+	SimPutWord(&pb[regaddr3v3ACurrentRequested], 250);
+
+	SimPutWord(&pb[regaddrVadjAVoltage], 180);
+	SimPutWord(&pb[regaddrVadjACurrentAllowed], 1000);
+	SimPutWord(&pb[regaddrVadjACurrentRequested], 100);
+	SimPutWord(&pb[regaddrVadjBVoltage], 180);
+	SimPutWord(&pb[regaddrVadjBCurrentAllowed], 1000);
+	SimPutWord(&pb[regaddrVadjBCurrentRequested], 150);
+	pb[regaddrVadjStatus + 0] = 0x03;
+	pb[regaddrVadjStatus + 1] = 0x03;
+
+	for ( iport = 0; iport < 2; iport++ ) {
+		pb[regaddrPortAI2cAddress + (offsetPortReg*iport)] = addrSimPodA + iport;
+		pb[regaddrPortA5v0Group + (offsetPortReg*iport)] = 0;
+		pb[regaddrPortA3v3Group + (offsetPortReg*iport)] = 0;
+		pb[regaddrPortAVioGroup + (offsetPortReg*iport)] = iport;
+		pb[regaddrPortAType + (offsetPortReg*iport)] = ptypeSyzygyStd;
+		pb[regaddrPortAStatus + (offsetPortReg*iport)] = 0x9D;
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    SimInitPod
+**
+**  Parameters:
+**      pdev            - simulated device to initialize
+**      pdid            - Digilent PDID of the pod
+**      szProduct       - product name stored in the DNA
+**      szModel         - product model stored in the DNA
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function populates the standard firmware registers, the
+**      SYZYGY DNA (with a valid CRC), the PDID and the factory and
+**      user calibration areas of a Digilent Zmod.
+*/
+static void
+SimInitPod(I2CSIM_DEV* pdev, DWORD pdid, const char* szProduct, const char* szModel) {
+
+	SzgDnaHeader	hdr;
+	ZMOD_ADC_CAL	cal;
+	const char*		rgsz[5];
+	WORD			addr;
+	WORD			crc;
+	BYTE			isz;
+	BYTE			ib;
+	BYTE*			pbCal;
+	BYTE			bSum;
+
+	pdev->rgbMem[0] = 1;
+	pdev->rgbMem[1] = 0;
+	pdev->rgbMem[2] = szgverMajor;
+	pdev->rgbMem[3] = szgverMinor;
+	pdev->rgbMem[4] = 0x10;
+	pdev->rgbMem[5] = 0x00;
+
+	rgsz[0] = "Digilent";
+	rgsz[1] = szProduct;
+	rgsz[2] = szModel;
+	rgsz[3] = "B";
+	rgsz[4] = "SIM000001";
+
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.cbDnaHeader = cbSyzygyDnaHeader;
+	hdr.dnaverMjr = szgverMajor;
+	hdr.dnaverMin = szgverMinor;
+	hdr.dnaverRequiredMjr = szgverMajor;
+	hdr.dnaverRequiredMin = szgverMinor;
+	hdr.crntRequired5v0 = 200;
+	hdr.crntRequired3v3 = 100;
+	hdr.crntRequiredVio = 50;
+	hdr.vltgRange1Min = 120;
+	hdr.vltgRange1Max = 330;
+	hdr.cbManufacturerName = strlen(rgsz[0]);
+	hdr.cbProductName = strlen(rgsz[1]);
+	hdr.cbProductModel = strlen(rgsz[2]);
+	hdr.cbProductVersion = strlen(rgsz[3]);
+	hdr.cbSerialNumber = strlen(rgsz[4]);
+	hdr.cbDna = cbSyzygyDnaHeader + hdr.cbManufacturerName + hdr.cbProductName +
+				hdr.cbProductModel + hdr.cbProductVersion + hdr.cbSerialNumber;
+
+	crc = SyzygyComputeCRC((BYTE*)&hdr, cbSyzygyDnaHeader - 2);
+	hdr.crcHigh = crc >> 8;
+	hdr.crcLow = crc & 0xFF;
+	memcpy(&pdev->rgbMem[addrDnaStart], &hdr, cbSyzygyDnaHeader);
+
+	addr = addrDnaStart + cbSyzygyDnaHeader;
+	for ( isz = 0; isz < 5; isz++ ) {
+		memcpy(&pdev->rgbMem[addr], rgsz[isz], strlen(rgsz[isz]));
+		addr += strlen(rgsz[isz]);
+	}
+
+	memcpy(&pdev->rgbMem[addrPdid], &pdid, 4);
+
+	/* The ADC and DAC calibration records share the same layout for
+	** everything the simulation fills in.
+	*/
+	memset(&cal, 0, sizeof(cal));
+	cal.id = 0xAD;
+	cal.date = 1577836800;
+	cal.cal[0][0][0] = 0.0125f;
+	cal.cal[0][0][1] = -0.0031f;
+	cal.cal[0][1][0] = -0.0042f;
+	cal.cal[0][1][1] = 0.0017f;
+	cal.cal[1][0][0] = 0.0093f;
+	cal.cal[1][0][1] = 0.0024f;
+	cal.cal[1][1][0] = -0.0011f;
+	cal.cal[1][1][1] = -0.0008f;
+
+	pbCal = (BYTE*)&cal;
+	bSum = 0;
+	for ( ib = 0; ib < sizeof(cal) - 1; ib++ ) {
+		bSum -= pbCal[ib];
+	}
+	cal.crc = bSum;
+
+	memcpy(&pdev->rgbMem[addrAdcFactCalStart], &cal, sizeof(cal));
+	memcpy(&pdev->rgbMem[addrAdcUserCalStart], &cal, sizeof(cal));
+}
+
+/* ------------------------------------------------------------ */
+/***    SimPmcuWritten
+**
+**  Parameters:
+**      pdev            - simulated Platform MCU
+**      addrFirst       - first register address written
+**      cb              - number of bytes written
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function applies the side effects of a Platform MCU register
+**      write. Writing a VADJ_n_OVERRIDE register updates the voltage and
+**      enable state of the supply.
+*/
+static void
+SimPmcuWritten(I2CSIM_DEV* pdev, WORD addrFirst, WORD cb) {
+
+	VADJ_OVERRIDE	vadjow;
+	BYTE			ivadj;
+	WORD			regaddr;
+
+	for ( ivadj = 0; ivadj < pdev->rgbMem[regaddrVadjGroupCount]; ivadj++ ) {
+		regaddr = regaddrVadjAOverride + (offsetVadjReg*ivadj);
+		if (( addrFirst >= regaddr + cbVadjAOverride ) || ( addrFirst + cb <= regaddr )) {
+			continue;
+		}
+
+		memcpy(&vadjow, &pdev->rgbMem[regaddr], sizeof(vadjow));
+		if ( vadjow.fOverride ) {
+			SimPutWord(&pdev->rgbMem[regaddrVadjAVoltage + (offsetVadjReg*ivadj)], vadjow.vltgSet);
+			if ( vadjow.fEnable ) {
+				pdev->rgbMem[regaddrVadjStatus] |= (1 << ivadj);
+				pdev->rgbMem[regaddrVadjStatus + 1] |= (1 << ivadj);
+			}
+			else {
+				pdev->rgbMem[regaddrVadjStatus] &= ~(1 << ivadj);
+				pdev->rgbMem[regaddrVadjStatus + 1] &= ~(1 << ivadj);
+			}
+		}
+		else {
+			SimPutWord(&pdev->rgbMem[regaddrVadjAVoltage + (offsetVadjReg*ivadj)], 180);
+			pdev->rgbMem[regaddrVadjStatus] |= (1 << ivadj);
+			pdev->rgbMem[regaddrVadjStatus + 1] |= (1 << ivadj);
+		}
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    SimPutWord
+**
+**  Parameters:
+**      pb              - pointer to the first byte of the register
+**      w               - value to store
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function stores a 16-bit register value, LSB first.
+*/
+static void
+SimPutWord(BYTE* pb, WORD w) {
+
+	pb[0] = w & 0xFF;
+	pb[1] = w >> 8;
+}
+
+/* ------------------------------------------------------------ */
+/***    PsimdevFromFd
+**
+**  Parameters:
+**      fd              - file descriptor returned by I2CSimOpen
+**
+**  Return Value:
+**      simulated device selected on the descriptor, NULL if no device
+**      responds at the selected slave address
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function finds the device addressed by a transaction. The
+**      caller must hold the simulation lock.
+*/
+static I2CSIM_DEV*
+PsimdevFromFd(int fd) {
+
+	if (( 0 > fd ) || ( cfdSimMax <= fd ) || ( ! fSimInit )) {
+		return NULL;
+	}
+
+	return PsimdevFromAddr(rgaddrSlave[fd]);
+}
+
+/* ------------------------------------------------------------ */
+/***    PsimdevFromAddr
+**
+**  Parameters:
+**      addrI2c         - I2C address of the simulated device
+**
+**  Return Value:
+**      simulated device responding at the address, NULL if none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function finds a simulated device by address. The caller
+**      must hold the simulation lock.
+*/
+static I2CSIM_DEV*
+PsimdevFromAddr(BYTE addrI2c) {
+
+	BYTE	isimdev;
+
+	for ( isimdev = 0; isimdev < csimdev; isimdev++ ) {
+		if ( rgsimdev[isimdev].addrI2c == addrI2c ) {
+			return &rgsimdev[isimdev];
+		}
+	}
+
+	return NULL;
+}
+
+/* ------------------------------------------------------------ */
+/***    UsSimNow
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      current value of the monotonic clock in microseconds
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function reads the monotonic clock.
+*/
+static UINT64
+UsSimNow() {
+
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((UINT64)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+#endif
@@ -0,0 +1,56 @@
+/************************************************************************/
+/*                                                                      */
+/*  I2CSim.h - Simulated Platform MCU / SYZYGY I2C bus declarations     */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file contains the declarations for a simulated I2C bus  */
+/*  that stands in for the linux i2c-dev interface when the HAL is      */
+/*  built with I2CHAL_SIM defined. The bus holds an Eclypse Z7 style    */
+/*  Platform MCU with a ZmodADC on port A and a ZmodDAC on port B, so   */
+/*  that commands can be exercised on machines without the hardware.    */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef I2CSIM_H_
+#define I2CSIM_H_
+
+#if defined(__linux__) && defined(I2CHAL_SIM)
+
+#include <sys/types.h>
+#include "stdtypes.h"
+
+/* ------------------------------------------------------------ */
+/*                  Miscellaneous Declarations                  */
+/* ------------------------------------------------------------ */
+
+/* Define the I2C addresses of the simulated SYZYGY pods.
+*/
+#define addrSimPodA			0x30
+#define addrSimPodB			0x31
+
+/* ------------------------------------------------------------ */
+/*                  Procedure Declarations                      */
+/* ------------------------------------------------------------ */
+
+int		I2CSimOpen(const char* szPath, int flags);
+int		I2CSimIoctl(int fd, unsigned long req, ...);
+ssize_t	I2CSimWrite(int fd, const void* pvBuf, size_t cb);
+ssize_t	I2CSimRead(int fd, void* pvBuf, size_t cb);
+BOOL	I2CSimSetTiming(BYTE addrI2c, UINT32 usTurnaround, UINT32 usBusy);
+BOOL	I2CSimSetFault(BYTE addrI2c, int errFault, UINT32 cFault);
+UINT32	I2CSimGetNackCount(BYTE addrI2c);
+
+#endif
+
+/* ------------------------------------------------------------ */
+
+#endif /* I2CSIM_H_ */
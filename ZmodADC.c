@@ -40,7 +40,9 @@
 #include <time.h>
 #include <stdlib.h>
 #include "stdtypes.h"
+#include "dpmutilcfg.h"
 #include "syzygy.h"
+#include "ZmodCal.h"
 #include "ZmodADC.h"
 
 /* ------------------------------------------------------------ */
@@ -79,6 +81,7 @@ int32_t ComputeAddCoefADC1410(float ca, BOOL fHighGain);
 /*              Procedure Definitions                           */
 /* ------------------------------------------------------------ */
 
+#if DPMUTIL_CFG_PRINT
 /* ------------------------------------------------------------ */
 /***    FDisplayZmodADCCal
 **
@@ -169,6 +172,7 @@ FDisplayZmodADCCal(int fdI2cDev, BYTE addrI2cSlave) {
 
     return fTrue;
 }
+#endif
 
 /* ------------------------------------------------------------ */
 /***    FGetZmodADCCal
@@ -196,14 +200,14 @@ FGetZmodADCCal(int fdI2cDev, BYTE addrI2cSlave, ZMOD_ADC_CAL *pFactoryCal, ZMOD_
     WORD            cbRead;
 
     if ( ! SyzygyI2cRead(fdI2cDev, addrI2cSlave, addrAdcFactCalStart, (BYTE*)pFactoryCal, sizeof(ZMOD_ADC_CAL), &cbRead) ) {
-        printf("Error: failed to read ZmodADC factory calibration from 0x%02X\n", addrI2cSlave);
-        printf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_ADC_CAL));
+        DpmPrintf("Error: failed to read ZmodADC factory calibration from 0x%02X\n", addrI2cSlave);
+        DpmPrintf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_ADC_CAL));
         return fFalse;
     }
 
     if ( ! SyzygyI2cRead(fdI2cDev, addrI2cSlave, addrAdcUserCalStart, (BYTE*)pUserCal, sizeof(ZMOD_ADC_CAL), &cbRead) ) {
-        printf("Error: failed to read ZmodADC user calibration from 0x%02X\n", addrI2cSlave);
-        printf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_ADC_CAL));
+        DpmPrintf("Error: failed to read ZmodADC user calibration from 0x%02X\n", addrI2cSlave);
+        DpmPrintf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_ADC_CAL));
         return fFalse;
     }
 
@@ -238,6 +242,46 @@ FZmodADCCalConvertToS18(ZMOD_ADC_CAL adcal, ZMOD_ADC_CAL_S18 *pReturn) {
 	pReturn->cal[1][1][1] = (unsigned int)ComputeAddCoefADC1410(adcal.cal[1][1][1], fTrue);
 }
 
+#if DPMUTIL_CFG_ZMODCAL
+/* ------------------------------------------------------------ */
+/***    FZmodADCCalGetKernel
+**
+**  Parameters:
+**      adcal           - ZMOD_ADC_CAL object to pull calibration coefficients from
+**      ch              - channel index (0 or 1)
+**      fHighGain       - fTrue for high gain setting, fFalse for low gain
+**      pkern           - ZMOD_CAL_KERNEL object to return the kernel through
+**
+**  Return Value:
+**      fTrue for success, fFalse if the channel index is invalid
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function computes the kernel used by ZmodCalPackedToVolts to
+**      convert raw ADC1410 codes of the specified channel and gain
+**      setting to calibrated voltages. This is the software equivalent
+**      of the coefficients computed by FZmodADCCalConvertToS18.
+*/
+BOOL
+FZmodADCCalGetKernel(ZMOD_ADC_CAL adcal, BYTE ch, BOOL fHighGain, ZMOD_CAL_KERNEL* pkern) {
+
+    double  real;
+
+    if ( 1 < ch ) {
+        return fFalse;
+    }
+
+    real = fHighGain ? ADC1410_REAL_RANGE_ADC_HIGH : ADC1410_REAL_RANGE_ADC_LOW;
+
+    pkern->flScale = (float)(real * (1 + adcal.cal[ch][fHighGain ? 1 : 0][0]) / ccodeZmodHalf);
+    pkern->flOffset = adcal.cal[ch][fHighGain ? 1 : 0][1];
+
+    return fTrue;
+}
+#endif
+
 /* ------------------------------------------------------------ */
 /***    ComputeMultCoefADC1410
 **
@@ -22,6 +22,8 @@
 #ifndef ZMODADC_H_
 #define ZMODADC_H_
 
+#include "dpmutilcfg.h"
+
 /* ------------------------------------------------------------ */
 /*                  Miscellaneous Declarations                  */
 /* ------------------------------------------------------------ */
@@ -66,9 +68,14 @@ typedef struct {
 /*                  Procedure Declarations                      */
 /* ------------------------------------------------------------ */
 
+#if DPMUTIL_CFG_PRINT
 BOOL    FDisplayZmodADCCal(int fdI2cDev, BYTE addrI2cSlave);
+#endif
 BOOL    FGetZmodADCCal(int fdI2cDev, BYTE addrI2cSlave, ZMOD_ADC_CAL* pFactoryCal, ZMOD_ADC_CAL* pUserCal);
 void    FZmodADCCalConvertToS18(ZMOD_ADC_CAL adcal, ZMOD_ADC_CAL_S18 *pReturn);
+#if DPMUTIL_CFG_ZMODCAL
+BOOL    FZmodADCCalGetKernel(ZMOD_ADC_CAL adcal, BYTE ch, BOOL fHighGain, ZMOD_CAL_KERNEL* pkern);
+#endif
 
 /* ------------------------------------------------------------ */
 
@@ -0,0 +1,765 @@
+/************************************************************************/
+/*                                                                      */
+/*  ZmodCal.c - Zmod sample calibration kernel implementation           */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This source file contains the implementation of functions that      */
+/*  convert raw Zmod sample codes to calibrated voltages and calibrated */
+/*  voltages to DAC codes. The packed functions read and write the      */
+/*  16-bit words of one channel of an interleaved DMA buffer directly,  */
+/*  extracting or inserting the code with a shift.                      */
+/*                                                                      */
+/*  A vectorised implementation of the packed functions is used when    */
+/*  the target supports one (NEON on ARM, SSE2 or AVX2 on x86).         */
+/*  ZmodCalSetImpl limits the implementations that may be used, so that */
+/*  each of them can be tested and measured on a processor that         */
+/*  supports a faster one. Every implementation performs exactly the    */
+/*  same sequence of single precision operations as the scalar          */
+/*  reference, so all of them produce bit identical results:            */
+/*                                                                      */
+/*      1. multiply by the scale (rounded to float)                     */
+/*      2. add the offset (rounded to float)                            */
+/*      3. DAC only: clamp to the code range, NaN maps to the minimum   */
+/*      4. DAC only: round to nearest even by adding and subtracting    */
+/*         1.5 * 2^23, then convert the integral value                  */
+/*                                                                      */
+/*  Fused multiply-add would change the rounding of step 1, so it is    */
+/*  disabled for this file.                                             */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#include "stdtypes.h"
+#include "dpmutilcfg.h"
+#include "ZmodCal.h"
+
+#if DPMUTIL_CFG_ZMODCAL
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ZMODCAL_NEON
+#elif defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#include <immintrin.h>
+#define ZMODCAL_SSE2
+#if defined(__GNUC__)
+#define ZMODCAL_AVX2
+#endif
+#endif
+
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+/* Adding and subtracting 1.5 * 2^23 rounds any float whose magnitude is
+** less than 2^22 to the nearest integer (ties to even).
+*/
+#define flRoundMagic	12582912.0f
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Global Variables                                */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static BYTE	zmodcalimplMax = zmodcalimplAvx2;
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static inline float	VltFromCode(INT32 code, float flScale, float flOffset);
+static inline INT32	CodeFromVlt(float vlt, float flScale, float flOffset);
+static BYTE			ZmodCalImpl();
+
+#if defined(ZMODCAL_NEON) || defined(ZMODCAL_SSE2)
+static DWORD	CsmpPackedToVoltsSimd(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp);
+static DWORD	CsmpVoltsToPackedSimd(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp);
+#endif
+#if defined(ZMODCAL_AVX2)
+static DWORD	CsmpPackedToVoltsAvx2(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp);
+static DWORD	CsmpVoltsToPackedAvx2(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp);
+#endif
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalPackedToVolts
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample of the channel
+**                        to the next, cwZmodStride for a Zmod stream
+**      cbitShift       - number of bits the code is shifted left in its
+**                        word, cbitZmodShift for a Zmod stream
+**      rgvlt           - buffer to return the voltages through
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function converts raw ADC1410 or Digitizer codes of one
+**      channel of a sample stream to calibrated voltages using the
+**      fastest implementation supported by the processor and allowed by
+**      ZmodCalSetImpl. Each code is the signed word shifted right by
+**      cbitShift bits, so the bits below the code are discarded.
+**
+**      Vectorised implementations are used for strides of 1 and 2
+**      words; other strides are converted by the scalar reference. No
+**      word beyond the last sample of the channel is read.
+*/
+void
+ZmodCalPackedToVolts(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp) {
+
+	DWORD	ismp;
+	BYTE	impl;
+
+	ismp = 0;
+	impl = ZmodCalImpl();
+
+#if defined(ZMODCAL_AVX2)
+	if ( zmodcalimplAvx2 == impl ) {
+		ismp = CsmpPackedToVoltsAvx2(pkern, rgw, cwStride, cbitShift, rgvlt, csmp);
+	}
+	else
+#endif
+	if ( zmodcalimplSimd == impl ) {
+#if defined(ZMODCAL_NEON) || defined(ZMODCAL_SSE2)
+		ismp = CsmpPackedToVoltsSimd(pkern, rgw, cwStride, cbitShift, rgvlt, csmp);
+#endif
+	}
+
+	ZmodCalPackedToVoltsScalar(pkern, &rgw[ismp * cwStride], cwStride, cbitShift, &rgvlt[ismp], csmp - ismp);
+}
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalVoltsToPacked
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgvlt           - voltages to convert
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample of the channel
+**                        to the next, cwZmodStride for a Zmod stream
+**      cbitShift       - number of bits to shift the code left in its
+**                        word, no more than cbitZmodShiftMax
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function converts voltages to calibrated DAC1411 codes and
+**      stores them in the words of one channel of a sample stream,
+**      using the fastest implementation supported by the processor and
+**      allowed by ZmodCalSetImpl. Voltages outside the range of the DAC
+**      saturate to the minimum or maximum code. The bits below the code
+**      are cleared.
+**
+**      Only the words of the channel are written, so the other channels
+**      of the stream may be converted concurrently.
+*/
+void
+ZmodCalVoltsToPacked(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp) {
+
+	DWORD	ismp;
+	BYTE	impl;
+
+	ismp = 0;
+	impl = ZmodCalImpl();
+
+#if defined(ZMODCAL_AVX2)
+	if ( zmodcalimplAvx2 == impl ) {
+		ismp = CsmpVoltsToPackedAvx2(pkern, rgvlt, rgw, cwStride, cbitShift, csmp);
+	}
+	else
+#endif
+	if ( zmodcalimplSimd == impl ) {
+#if defined(ZMODCAL_NEON) || defined(ZMODCAL_SSE2)
+		ismp = CsmpVoltsToPackedSimd(pkern, rgvlt, rgw, cwStride, cbitShift, csmp);
+#endif
+	}
+
+	ZmodCalVoltsToPackedScalar(pkern, &rgvlt[ismp], &rgw[ismp * cwStride], cwStride, cbitShift, csmp - ismp);
+}
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalPackedToVoltsScalar
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample to the next
+**      cbitShift       - number of bits the code is shifted left
+**      rgvlt           - buffer to return the voltages through
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function is the portable reference implementation of
+**      ZmodCalPackedToVolts.
+*/
+void
+ZmodCalPackedToVoltsScalar(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp) {
+
+	DWORD	ismp;
+
+	for ( ismp = 0; ismp < csmp; ismp++ ) {
+		rgvlt[ismp] = VltFromCode(rgw[ismp * cwStride] >> cbitShift, pkern->flScale, pkern->flOffset);
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalVoltsToPackedScalar
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgvlt           - voltages to convert
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample to the next
+**      cbitShift       - number of bits to shift the code left
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function is the portable reference implementation of
+**      ZmodCalVoltsToPacked.
+*/
+void
+ZmodCalVoltsToPackedScalar(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp) {
+
+	DWORD	ismp;
+
+	for ( ismp = 0; ismp < csmp; ismp++ ) {
+		rgw[ismp * cwStride] = (INT16)(CodeFromVlt(rgvlt[ismp], pkern->flScale, pkern->flOffset) * (1 << cbitShift));
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalCodesToVolts
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgsmp           - buffer of samples, each holding a sign extended
+**                        14-bit code on entry and a voltage on return
+**      csmp            - number of samples in the buffer
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function converts raw ADC1410 or Digitizer codes that were
+**      already unpacked to one 32-bit slot per sample to calibrated
+**      voltages, in place. It's a convenience for such callers and
+**      isn't vectorised; sample streams should be converted with
+**      ZmodCalPackedToVolts.
+*/
+void
+ZmodCalCodesToVolts(const ZMOD_CAL_KERNEL* pkern, ZMOD_SAMPLE* rgsmp, DWORD csmp) {
+
+	DWORD	ismp;
+
+	for ( ismp = 0; ismp < csmp; ismp++ ) {
+		rgsmp[ismp].vlt = VltFromCode(rgsmp[ismp].code, pkern->flScale, pkern->flOffset);
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalVoltsToCodes
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgsmp           - buffer of samples, each holding a voltage on
+**                        entry and a sign extended 14-bit code on return
+**      csmp            - number of samples in the buffer
+**
+**  Return Value:
+**      none
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function converts voltages to calibrated DAC1411 codes, one
+**      32-bit slot per sample, in place. It's a convenience for callers
+**      that pack the codes themselves and isn't vectorised; sample
+**      streams should be converted with ZmodCalVoltsToPacked.
+*/
+void
+ZmodCalVoltsToCodes(const ZMOD_CAL_KERNEL* pkern, ZMOD_SAMPLE* rgsmp, DWORD csmp) {
+
+	DWORD	ismp;
+
+	for ( ismp = 0; ismp < csmp; ismp++ ) {
+		rgsmp[ismp].code = CodeFromVlt(rgsmp[ismp].vlt, pkern->flScale, pkern->flOffset);
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalSetImpl
+**
+**  Parameters:
+**      implMax         - fastest implementation that may be used, one of
+**                        zmodcalimplScalar, zmodcalimplSimd or
+**                        zmodcalimplAvx2
+**
+**  Return Value:
+**      implementation that ZmodCalPackedToVolts and ZmodCalVoltsToPacked
+**      use from now on
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function limits the implementations used by the packed
+**      conversion functions. The fastest implementation that is no
+**      faster than implMax and that is supported by both the target and
+**      the processor is used. The default allows every implementation.
+*/
+BYTE
+ZmodCalSetImpl(BYTE implMax) {
+
+	zmodcalimplMax = implMax;
+
+	return ZmodCalImpl();
+}
+
+/* ------------------------------------------------------------ */
+/***    ZmodCalImpl
+**
+**  Parameters:
+**      none
+**
+**  Return Value:
+**      implementation to be used by the conversion functions
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function selects the fastest implementation allowed by
+**      ZmodCalSetImpl that the target and the processor support.
+*/
+static BYTE
+ZmodCalImpl() {
+
+#if defined(ZMODCAL_AVX2)
+	if (( zmodcalimplAvx2 <= zmodcalimplMax ) && ( __builtin_cpu_supports("avx2") )) {
+		return zmodcalimplAvx2;
+	}
+#endif
+#if defined(ZMODCAL_NEON) || defined(ZMODCAL_SSE2)
+	if ( zmodcalimplSimd <= zmodcalimplMax ) {
+		return zmodcalimplSimd;
+	}
+#endif
+
+	return zmodcalimplScalar;
+}
+
+/* ------------------------------------------------------------ */
+/***    VltFromCode
+**
+**  Parameters:
+**      code            - sign extended 14-bit sample code
+**      flScale         - volts per code
+**      flOffset        - offset in volts
+**
+**  Return Value:
+**      calibrated voltage
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function converts a single code to a calibrated voltage.
+*/
+static inline float
+VltFromCode(INT32 code, float flScale, float flOffset) {
+
+	float	vlt;
+
+	vlt = (float)code * flScale;
+	vlt = vlt + flOffset;
+
+	return vlt;
+}
+
+/* ------------------------------------------------------------ */
+/***    CodeFromVlt
+**
+**  Parameters:
+**      vlt             - voltage to convert
+**      flScale         - codes per volt
+**      flOffset        - offset in codes
+**
+**  Return Value:
+**      calibrated DAC code, saturated to the 14-bit code range
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function converts a single voltage to a calibrated DAC code.
+**      The comparisons are written so that they behave exactly like the
+**      vector max and min instructions, including for NaN.
+*/
+static inline INT32
+CodeFromVlt(float vlt, float flScale, float flOffset) {
+
+	float	fl;
+
+	fl = vlt * flScale;
+	fl = fl + flOffset;
+	fl = ( fl > (float)codeZmodMin ) ? fl : (float)codeZmodMin;
+	fl = ( fl < (float)codeZmodMax ) ? fl : (float)codeZmodMax;
+	fl = fl + flRoundMagic;
+	fl = fl - flRoundMagic;
+
+	return (INT32)fl;
+}
+
+#if defined(ZMODCAL_NEON) || defined(ZMODCAL_SSE2)
+/* ------------------------------------------------------------ */
+/***    CsmpPackedToVoltsSimd
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample to the next
+**      cbitShift       - number of bits the code is shifted left
+**      rgvlt           - buffer to return the voltages through
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      number of samples converted
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function is the NEON and SSE2 implementation of
+**      ZmodCalPackedToVolts. It converts 8 samples at a time for
+**      strides of 1 word, and 4 (SSE2) or 8 (NEON) samples at a time
+**      for strides of 2 words. The last vector of a stride of 2 would
+**      read the word after the last sample, so it's left to the caller
+**      together with the remaining samples and other strides.
+**
+**      The code is sign extended by placing its word in the upper half
+**      of a 32-bit lane and shifting it right arithmetically.
+*/
+static DWORD
+CsmpPackedToVoltsSimd(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp) {
+
+	DWORD	ismp;
+
+#if defined(ZMODCAL_NEON)
+	float32x4_t	vscale = vdupq_n_f32(pkern->flScale);
+	float32x4_t	voffset = vdupq_n_f32(pkern->flOffset);
+	int32x4_t	vshift = vdupq_n_s32(-(int32_t)cbitShift);
+	int16x8_t	vw;
+	float32x4_t	vlo;
+	float32x4_t	vhi;
+
+	for ( ismp = 0; ismp + 8 <= csmp; ismp += 8 ) {
+		if ( 1 == cwStride ) {
+			vw = vld1q_s16(&rgw[ismp]);
+		}
+		else if (( 2 == cwStride ) && ( ismp + 8 < csmp )) {
+			vw = vld2q_s16(&rgw[2 * ismp]).val[0];
+		}
+		else {
+			break;
+		}
+		vlo = vcvtq_f32_s32(vshlq_s32(vmovl_s16(vget_low_s16(vw)), vshift));
+		vhi = vcvtq_f32_s32(vshlq_s32(vmovl_s16(vget_high_s16(vw)), vshift));
+		vst1q_f32(&rgvlt[ismp], vaddq_f32(vmulq_f32(vlo, vscale), voffset));
+		vst1q_f32(&rgvlt[ismp + 4], vaddq_f32(vmulq_f32(vhi, vscale), voffset));
+	}
+#elif defined(ZMODCAL_SSE2)
+	__m128	vscale = _mm_set1_ps(pkern->flScale);
+	__m128	voffset = _mm_set1_ps(pkern->flOffset);
+	__m128i	vshift = _mm_cvtsi32_si128(16 + cbitShift);
+	__m128i	vw;
+	__m128	v;
+
+	ismp = 0;
+
+	if ( 1 == cwStride ) {
+		for ( ; ismp + 8 <= csmp; ismp += 8 ) {
+			vw = _mm_loadu_si128((const __m128i*)&rgw[ismp]);
+			v = _mm_cvtepi32_ps(_mm_sra_epi32(_mm_unpacklo_epi16(vw, vw), vshift));
+			_mm_storeu_ps(&rgvlt[ismp], _mm_add_ps(_mm_mul_ps(v, vscale), voffset));
+			v = _mm_cvtepi32_ps(_mm_sra_epi32(_mm_unpackhi_epi16(vw, vw), vshift));
+			_mm_storeu_ps(&rgvlt[ismp + 4], _mm_add_ps(_mm_mul_ps(v, vscale), voffset));
+		}
+	}
+	else if ( 2 == cwStride ) {
+		for ( ; ismp + 4 < csmp; ismp += 4 ) {
+			vw = _mm_loadu_si128((const __m128i*)&rgw[2 * ismp]);
+			v = _mm_cvtepi32_ps(_mm_sra_epi32(_mm_slli_epi32(vw, 16), vshift));
+			_mm_storeu_ps(&rgvlt[ismp], _mm_add_ps(_mm_mul_ps(v, vscale), voffset));
+		}
+	}
+#endif
+
+	return ismp;
+}
+
+/* ------------------------------------------------------------ */
+/***    CsmpVoltsToPackedSimd
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgvlt           - voltages to convert
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample to the next
+**      cbitShift       - number of bits to shift the code left
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      number of samples converted, always a multiple of 4
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function is the NEON and SSE2 implementation of
+**      ZmodCalVoltsToPacked. The codes are computed 4 at a time. They
+**      are stored as a single vector for a stride of 1 word, and one
+**      word at a time otherwise, so that the words of the other
+**      channels are never written. The remaining samples are left to
+**      the caller.
+*/
+static DWORD
+CsmpVoltsToPackedSimd(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp) {
+
+	INT32	rgcode[4];
+	DWORD	ismp;
+	DWORD	icode;
+
+#if defined(ZMODCAL_NEON)
+	float32x4_t	vscale = vdupq_n_f32(pkern->flScale);
+	float32x4_t	voffset = vdupq_n_f32(pkern->flOffset);
+	float32x4_t	vmin = vdupq_n_f32((float)codeZmodMin);
+	float32x4_t	vmax = vdupq_n_f32((float)codeZmodMax);
+	float32x4_t	vmagic = vdupq_n_f32(flRoundMagic);
+	int32x4_t	vshift = vdupq_n_s32(cbitShift);
+	float32x4_t	v;
+	int32x4_t	vcode;
+
+	for ( ismp = 0; ismp + 4 <= csmp; ismp += 4 ) {
+		v = vld1q_f32(&rgvlt[ismp]);
+		v = vaddq_f32(vmulq_f32(v, vscale), voffset);
+		v = vbslq_f32(vcgtq_f32(v, vmin), v, vmin);
+		v = vbslq_f32(vcltq_f32(v, vmax), v, vmax);
+		v = vsubq_f32(vaddq_f32(v, vmagic), vmagic);
+		vcode = vshlq_s32(vcvtq_s32_f32(v), vshift);
+		if ( 1 == cwStride ) {
+			vst1_s16(&rgw[ismp], vmovn_s32(vcode));
+			continue;
+		}
+		vst1q_s32(rgcode, vcode);
+		for ( icode = 0; icode < 4; icode++ ) {
+			rgw[(ismp + icode) * cwStride] = (INT16)rgcode[icode];
+		}
+	}
+#elif defined(ZMODCAL_SSE2)
+	__m128	vscale = _mm_set1_ps(pkern->flScale);
+	__m128	voffset = _mm_set1_ps(pkern->flOffset);
+	__m128	vmin = _mm_set1_ps((float)codeZmodMin);
+	__m128	vmax = _mm_set1_ps((float)codeZmodMax);
+	__m128	vmagic = _mm_set1_ps(flRoundMagic);
+	__m128i	vshift = _mm_cvtsi32_si128(cbitShift);
+	__m128	v;
+	__m128i	vcode;
+
+	for ( ismp = 0; ismp + 4 <= csmp; ismp += 4 ) {
+		v = _mm_loadu_ps(&rgvlt[ismp]);
+		v = _mm_add_ps(_mm_mul_ps(v, vscale), voffset);
+		v = _mm_max_ps(v, vmin);
+		v = _mm_min_ps(v, vmax);
+		v = _mm_sub_ps(_mm_add_ps(v, vmagic), vmagic);
+		vcode = _mm_sll_epi32(_mm_cvttps_epi32(v), vshift);
+		if ( 1 == cwStride ) {
+			_mm_storel_epi64((__m128i*)&rgw[ismp], _mm_packs_epi32(vcode, vcode));
+			continue;
+		}
+		_mm_storeu_si128((__m128i*)rgcode, vcode);
+		for ( icode = 0; icode < 4; icode++ ) {
+			rgw[(ismp + icode) * cwStride] = (INT16)rgcode[icode];
+		}
+	}
+#endif
+
+	return ismp;
+}
+#endif
+
+#if defined(ZMODCAL_AVX2)
+/* ------------------------------------------------------------ */
+/***    CsmpPackedToVoltsAvx2
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample to the next
+**      cbitShift       - number of bits the code is shifted left
+**      rgvlt           - buffer to return the voltages through
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      number of samples converted
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function is the AVX2 implementation of ZmodCalPackedToVolts.
+**      It converts 8 samples at a time for strides of 1 and 2 words. The
+**      last vector of a stride of 2 would read the word after the last
+**      sample, so it's left to the caller together with the remaining
+**      samples and other strides.
+*/
+__attribute__((target("avx2")))
+static DWORD
+CsmpPackedToVoltsAvx2(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp) {
+
+	__m256	vscale = _mm256_set1_ps(pkern->flScale);
+	__m256	voffset = _mm256_set1_ps(pkern->flOffset);
+	__m128i	vshift = _mm_cvtsi32_si128(cbitShift);
+	__m128i	vshift16 = _mm_cvtsi32_si128(16 + cbitShift);
+	__m256i	vcode;
+	__m256	v;
+	DWORD	ismp;
+
+	ismp = 0;
+
+	if ( 1 == cwStride ) {
+		for ( ; ismp + 8 <= csmp; ismp += 8 ) {
+			vcode = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&rgw[ismp]));
+			v = _mm256_cvtepi32_ps(_mm256_sra_epi32(vcode, vshift));
+			_mm256_storeu_ps(&rgvlt[ismp], _mm256_add_ps(_mm256_mul_ps(v, vscale), voffset));
+		}
+	}
+	else if ( 2 == cwStride ) {
+		for ( ; ismp + 8 < csmp; ismp += 8 ) {
+			vcode = _mm256_loadu_si256((const __m256i*)&rgw[2 * ismp]);
+			v = _mm256_cvtepi32_ps(_mm256_sra_epi32(_mm256_slli_epi32(vcode, 16), vshift16));
+			_mm256_storeu_ps(&rgvlt[ismp], _mm256_add_ps(_mm256_mul_ps(v, vscale), voffset));
+		}
+	}
+
+	return ismp;
+}
+
+/* ------------------------------------------------------------ */
+/***    CsmpVoltsToPackedAvx2
+**
+**  Parameters:
+**      pkern           - calibration kernel of the channel and gain
+**      rgvlt           - voltages to convert
+**      rgw             - first sample word of the channel
+**      cwStride        - number of words from one sample to the next
+**      cbitShift       - number of bits to shift the code left
+**      csmp            - number of samples to convert
+**
+**  Return Value:
+**      number of samples converted, always a multiple of 8
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function is the AVX2 implementation of ZmodCalVoltsToPacked.
+**      The codes are computed 8 at a time and stored like
+**      CsmpVoltsToPackedSimd does. The remaining samples are left to the
+**      caller.
+*/
+__attribute__((target("avx2")))
+static DWORD
+CsmpVoltsToPackedAvx2(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp) {
+
+	__m256	vscale = _mm256_set1_ps(pkern->flScale);
+	__m256	voffset = _mm256_set1_ps(pkern->flOffset);
+	__m256	vmin = _mm256_set1_ps((float)codeZmodMin);
+	__m256	vmax = _mm256_set1_ps((float)codeZmodMax);
+	__m256	vmagic = _mm256_set1_ps(flRoundMagic);
+	__m128i	vshift = _mm_cvtsi32_si128(cbitShift);
+	__m256	v;
+	__m256i	vcode;
+	INT32	rgcode[8];
+	DWORD	ismp;
+	DWORD	icode;
+
+	for ( ismp = 0; ismp + 8 <= csmp; ismp += 8 ) {
+		v = _mm256_loadu_ps(&rgvlt[ismp]);
+		v = _mm256_add_ps(_mm256_mul_ps(v, vscale), voffset);
+		v = _mm256_max_ps(v, vmin);
+		v = _mm256_min_ps(v, vmax);
+		v = _mm256_sub_ps(_mm256_add_ps(v, vmagic), vmagic);
+		vcode = _mm256_sll_epi32(_mm256_cvttps_epi32(v), vshift);
+		if ( 1 == cwStride ) {
+			_mm_storeu_si128((__m128i*)&rgw[ismp],
+				_mm_packs_epi32(_mm256_castsi256_si128(vcode), _mm256_extracti128_si256(vcode, 1)));
+			continue;
+		}
+		_mm256_storeu_si256((__m256i*)rgcode, vcode);
+		for ( icode = 0; icode < 8; icode++ ) {
+			rgw[(ismp + icode) * cwStride] = (INT16)rgcode[icode];
+		}
+	}
+
+	return ismp;
+}
+#endif
+
+#endif /* DPMUTIL_CFG_ZMODCAL */
@@ -0,0 +1,108 @@
+/************************************************************************/
+/*                                                                      */
+/*  ZmodCal.h - Zmod sample calibration kernel declarations             */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file contains the declarations for functions that can   */
+/*  be used to apply the calibration stored in the DNA of a ZmodADC,    */
+/*  ZmodDigitizer or ZmodDAC to sample buffers in software, for designs */
+/*  that don't pass samples through the PL calibration block.           */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef ZMODCAL_H_
+#define ZMODCAL_H_
+
+#include "dpmutilcfg.h"
+
+/* ------------------------------------------------------------ */
+/*                  Miscellaneous Declarations                  */
+/* ------------------------------------------------------------ */
+
+/* Define the range of the signed 14-bit sample codes used by the
+** ADC1410, the Digitizer and the DAC1411.
+*/
+#define codeZmodMin         (-8192)
+#define codeZmodMax         8191
+#define ccodeZmodHalf       8192
+
+/* Define the implementations of the conversion functions, slowest
+** first, see ZmodCalSetImpl.
+**
+**  zmodcalimplScalar   - portable reference implementation
+**  zmodcalimplSimd     - 128-bit vectors using NEON or SSE2
+**  zmodcalimplAvx2     - 256-bit vectors using AVX2
+*/
+#define zmodcalimplScalar   0
+#define zmodcalimplSimd     1
+#define zmodcalimplAvx2     2
+
+/* Define the layout of the 16-bit sample words of the Zmod DMA streams.
+** The ADC1410 and the Digitizer interleave the words of their two
+** channels, each holding a 14-bit code left justified in the word. The
+** DAC1411 takes the same layout. The codes of the packed kernels may be
+** shifted by at most cbitZmodShiftMax bits, so that every 14-bit code
+** fits in its word.
+*/
+#define cwZmodStride        2
+#define cbitZmodShift       2
+#define cbitZmodShiftMax    2
+
+/* ------------------------------------------------------------ */
+/*                  General Type Declarations                   */
+/* ------------------------------------------------------------ */
+
+/* A sample slot holds either a signed (sign extended) 14-bit code or a
+** voltage. It's used by ZmodCalCodesToVolts and ZmodCalVoltsToCodes,
+** which convert buffers that the caller already unpacked to one 32-bit
+** slot per sample, in place. Sample streams should be converted
+** directly from and to their 16-bit words by ZmodCalPackedToVolts and
+** ZmodCalVoltsToPacked instead.
+*/
+typedef union {
+	INT32	code;
+	float	vlt;
+} ZMOD_SAMPLE;
+
+/* A kernel applies the calibration of one channel at one gain setting
+** (or one frequency step for the Digitizer):
+**
+**  ADC/Digitizer:  vlt  = code * flScale + flOffset
+**  DAC:            code = round(vlt * flScale + flOffset), saturated to
+**                         the 14-bit code range
+*/
+typedef struct {
+	float	flScale;
+	float	flOffset;
+} ZMOD_CAL_KERNEL;
+
+/* ------------------------------------------------------------ */
+/*                  Variable Declarations                       */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/*                  Procedure Declarations                      */
+/* ------------------------------------------------------------ */
+
+#if DPMUTIL_CFG_ZMODCAL
+void	ZmodCalPackedToVolts(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp);
+void	ZmodCalVoltsToPacked(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp);
+void	ZmodCalPackedToVoltsScalar(const ZMOD_CAL_KERNEL* pkern, const INT16* rgw, DWORD cwStride, BYTE cbitShift, float* rgvlt, DWORD csmp);
+void	ZmodCalVoltsToPackedScalar(const ZMOD_CAL_KERNEL* pkern, const float* rgvlt, INT16* rgw, DWORD cwStride, BYTE cbitShift, DWORD csmp);
+void	ZmodCalCodesToVolts(const ZMOD_CAL_KERNEL* pkern, ZMOD_SAMPLE* rgsmp, DWORD csmp);
+void	ZmodCalVoltsToCodes(const ZMOD_CAL_KERNEL* pkern, ZMOD_SAMPLE* rgsmp, DWORD csmp);
+BYTE	ZmodCalSetImpl(BYTE implMax);
+#endif
+
+/* ------------------------------------------------------------ */
+
+#endif /* ZMODCAL_H_ */
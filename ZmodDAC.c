@@ -43,7 +43,9 @@
 #include <time.h>
 #include <stdlib.h>
 #include "stdtypes.h"
+#include "dpmutilcfg.h"
 #include "syzygy.h"
+#include "ZmodCal.h"
 #include "ZmodDAC.h"
 
 /* ------------------------------------------------------------ */
@@ -82,6 +84,7 @@ int32_t ComputeAddCoefDAC1411(float ca, float cg, BOOL fHighGain);
 /*              Procedure Definitions                           */
 /* ------------------------------------------------------------ */
 
+#if DPMUTIL_CFG_PRINT
 /* ------------------------------------------------------------ */
 /***    FDisplayZmodDACCal
 **
@@ -172,6 +175,7 @@ FDisplayZmodDACCal(int fdI2cDev, BYTE addrI2cSlave) {
 
     return fTrue;
 }
+#endif
 
 /* ------------------------------------------------------------ */
 /***    FGetZmodDACCal
@@ -199,14 +203,14 @@ FGetZmodDACCal(int fdI2cDev, BYTE addrI2cSlave, ZMOD_DAC_CAL *pFactoryCal, ZMOD_
     WORD            cbRead;
 
     if ( ! SyzygyI2cRead(fdI2cDev, addrI2cSlave, addrDacFactCalStart, (BYTE*)pFactoryCal, sizeof(ZMOD_DAC_CAL), &cbRead) ) {
-        printf("Error: failed to read ZmodDAC factory calibration from 0x%02X\n", addrI2cSlave);
-        printf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DAC_CAL));
+        DpmPrintf("Error: failed to read ZmodDAC factory calibration from 0x%02X\n", addrI2cSlave);
+        DpmPrintf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DAC_CAL));
         return fFalse;
     }
 
     if ( ! SyzygyI2cRead(fdI2cDev, addrI2cSlave, addrDacUserCalStart, (BYTE*)pUserCal, sizeof(ZMOD_DAC_CAL), &cbRead) ) {
-        printf("Error: failed to read ZmodDAC user calibration from 0x%02X\n", addrI2cSlave);
-        printf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DAC_CAL));
+        DpmPrintf("Error: failed to read ZmodDAC user calibration from 0x%02X\n", addrI2cSlave);
+        DpmPrintf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DAC_CAL));
         return fFalse;
     }
 
@@ -241,6 +245,48 @@ FZmodDACCalConvertToS18(ZMOD_DAC_CAL dacal, ZMOD_DAC_CAL_S18 *pReturn) {
 	pReturn->cal[1][1][1] = (unsigned int)ComputeAddCoefDAC1411(dacal.cal[1][1][1], dacal.cal[1][1][0], fTrue);
 }
 
+#if DPMUTIL_CFG_ZMODCAL
+/* ------------------------------------------------------------ */
+/***    FZmodDACCalGetKernel
+**
+**  Parameters:
+**      dacal           - ZMOD_DAC_CAL object to pull calibration coefficients from
+**      ch              - channel index (0 or 1)
+**      fHighGain       - fTrue for high gain setting, fFalse for low gain
+**      pkern           - ZMOD_CAL_KERNEL object to return the kernel through
+**
+**  Return Value:
+**      fTrue for success, fFalse if the channel index is invalid
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function computes the kernel used by ZmodCalVoltsToPacked to
+**      convert voltages to calibrated DAC1411 codes for the specified
+**      channel and gain setting. This is the software equivalent of the
+**      coefficients computed by FZmodDACCalConvertToS18.
+*/
+BOOL
+FZmodDACCalGetKernel(ZMOD_DAC_CAL dacal, BYTE ch, BOOL fHighGain, ZMOD_CAL_KERNEL* pkern) {
+
+    double  real;
+    double  scale;
+
+    if ( 1 < ch ) {
+        return fFalse;
+    }
+
+    real = fHighGain ? DAC1411_REAL_RANGE_DAC_HIGH : DAC1411_REAL_RANGE_DAC_LOW;
+    scale = ccodeZmodHalf / (real * (1 + dacal.cal[ch][fHighGain ? 1 : 0][0]));
+
+    pkern->flScale = (float)scale;
+    pkern->flOffset = (float)(-dacal.cal[ch][fHighGain ? 1 : 0][1] * scale);
+
+    return fTrue;
+}
+#endif
+
 /* ------------------------------------------------------------ */
 /***    ComputeMultCoefDAC1411
 **
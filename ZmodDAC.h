@@ -22,6 +22,8 @@
 #ifndef ZMODDAC_H_
 #define ZMODDAC_H_
 
+#include "dpmutilcfg.h"
+
 /* ------------------------------------------------------------ */
 /*                  Miscellaneous Declarations                  */
 /* ------------------------------------------------------------ */
@@ -66,9 +68,14 @@ typedef struct {
 /*                  Procedure Declarations                      */
 /* ------------------------------------------------------------ */
 
+#if DPMUTIL_CFG_PRINT
 BOOL    FDisplayZmodDACCal(int fdI2cDev, BYTE addrI2cSLave);
+#endif
 BOOL    FGetZmodDACCal(int fdI2cDev, BYTE addrI2cSlave, ZMOD_DAC_CAL* pFactoryCal, ZMOD_DAC_CAL* pUserCal);
 void    FZmodDACCalConvertToS18(ZMOD_DAC_CAL adcal, ZMOD_DAC_CAL_S18 *pReturn);
+#if DPMUTIL_CFG_ZMODCAL
+BOOL    FZmodDACCalGetKernel(ZMOD_DAC_CAL dacal, BYTE ch, BOOL fHighGain, ZMOD_CAL_KERNEL* pkern);
+#endif
 
 /* ------------------------------------------------------------ */
 
@@ -36,7 +36,9 @@
 #include <time.h>
 #include <stdlib.h>
 #include "stdtypes.h"
+#include "dpmutilcfg.h"
 #include "syzygy.h"
+#include "ZmodCal.h"
 #include "ZmodDigitizer.h"
 
 /* ------------------------------------------------------------ */
@@ -74,6 +76,7 @@ int32_t ComputeAddCoefDigitizer(float ca);
 /*              Procedure Definitions                           */
 /* ------------------------------------------------------------ */
 
+#if DPMUTIL_CFG_PRINT
 /* ------------------------------------------------------------ */
 /***    FDisplayZmodDigitizerCal
 **
@@ -161,6 +164,7 @@ FDisplayZmodDigitizerCal(int fdI2cDev, BYTE addrI2cSlave) {
 
     return fTrue;
 }
+#endif
 
 /* ------------------------------------------------------------ */
 /***    FGetZmodDigitizerCal
@@ -188,14 +192,14 @@ FGetZmodDigitizerCal(int fdI2cDev, BYTE addrI2cSlave, ZMOD_DIGITIZER_CAL *pFacto
     WORD            cbRead;
 
     if ( ! SyzygyI2cRead(fdI2cDev, addrI2cSlave, addrDigitizerFactCalStart, (BYTE*)pFactoryCal, sizeof(ZMOD_DIGITIZER_CAL), &cbRead) ) {
-        printf("Error: failed to read ZmodDigitizer factory calibration from 0x%02X\n", addrI2cSlave);
-        printf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DIGITIZER_CAL));
+        DpmPrintf("Error: failed to read ZmodDigitizer factory calibration from 0x%02X\n", addrI2cSlave);
+        DpmPrintf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DIGITIZER_CAL));
         return fFalse;
     }
 
     if ( ! SyzygyI2cRead(fdI2cDev, addrI2cSlave, addrDigitizerUserCalStart, (BYTE*)pUserCal, sizeof(ZMOD_DIGITIZER_CAL), &cbRead) ) {
-        printf("Error: failed to read ZmodDigitizer user calibration from 0x%02X\n", addrI2cSlave);
-        printf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DIGITIZER_CAL));
+        DpmPrintf("Error: failed to read ZmodDigitizer user calibration from 0x%02X\n", addrI2cSlave);
+        DpmPrintf("Error: received %d of %d bytes\n", cbRead, sizeof(ZMOD_DIGITIZER_CAL));
         return fFalse;
     }
 
@@ -229,6 +233,44 @@ FZmodDigitizerCalConvertToS18(ZMOD_DIGITIZER_CAL adcal, ZMOD_DIGITIZER_CAL_S18 *
     }
 }
 
+#if DPMUTIL_CFG_ZMODCAL
+/* ------------------------------------------------------------ */
+/***    FZmodDigitizerCalGetKernel
+**
+**  Parameters:
+**      adcal           - ZMOD_DIGITIZER_CAL object to pull calibration coefficients from
+**      ihz             - frequency step index (0 to cbDigitizerCalibHzSteps-1)
+**      ch              - channel index (0 or 1)
+**      pkern           - ZMOD_CAL_KERNEL object to return the kernel through
+**
+**  Return Value:
+**      fTrue for success, fFalse if the frequency step or channel index
+**      is invalid
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function computes the kernel used by ZmodCalPackedToVolts to
+**      convert raw Digitizer codes of the specified channel, sampled at
+**      the specified frequency step, to calibrated voltages. This is the
+**      software equivalent of the coefficients computed by
+**      FZmodDigitizerCalConvertToS18.
+*/
+BOOL
+FZmodDigitizerCalGetKernel(ZMOD_DIGITIZER_CAL adcal, BYTE ihz, BYTE ch, ZMOD_CAL_KERNEL* pkern) {
+
+    if (( cbDigitizerCalibHzSteps <= ihz ) || ( 1 < ch )) {
+        return fFalse;
+    }
+
+    pkern->flScale = (float)(DIGITIZER_REAL_RANGE_ADC * (1 + adcal.cal[ihz][ch][0]) / ccodeZmodHalf);
+    pkern->flOffset = adcal.cal[ihz][ch][1];
+
+    return fTrue;
+}
+#endif
+
 /* ------------------------------------------------------------ */
 /***    ComputeMultCoefDigitizer
 **
@@ -22,6 +22,8 @@
 #ifndef ZMODDIGITIZER_H_
 #define ZMODDIGITIZER_H_
 
+#include "dpmutilcfg.h"
+
 /* ------------------------------------------------------------ */
 /*                  Miscellaneous Declarations                  */
 /* ------------------------------------------------------------ */
@@ -36,6 +38,11 @@
 
 #define cbDigitizerCalMax         128
 
+/* The ZmodDigitizer shares its product number with the ZmodADC. Its
+** calibration records are told apart by their id.
+*/
+#define idDigitizerCal            0xDD
+
 // The number of frequencies that the digitizer was calibrated at, for which coefficients are stored in DNA
 #define cbDigitizerCalibHzSteps   7
 
@@ -46,7 +53,7 @@
 #pragma pack(push, 1)
 
 typedef struct ZMOD_DIGITIZER_CAL {    			  // 128 B
-    BYTE     id;             					  // 0xDD
+    BYTE     id;             					  // idDigitizerCal
     int32_t  date;           					  // unix time, secs since epoch
     BYTE     hz[cbDigitizerCalibHzSteps];         // 7 steps: 0=122.88MHz, 50(MHz), 80(MHz), 100(MHz), 110(MHz), 120(MHz), 125(MHz)
     BYTE     nop[3];         					  // reserved
@@ -70,9 +77,14 @@ typedef struct {
 /*                  Procedure Declarations                      */
 /* ------------------------------------------------------------ */
 
+#if DPMUTIL_CFG_PRINT
 BOOL    FDisplayZmodDigitizerCal(int fdI2cDev, BYTE addrI2cSlave);
+#endif
 BOOL    FGetZmodDigitizerCal(int fdI2cDev, BYTE addrI2cSlave, ZMOD_DIGITIZER_CAL* pFactoryCal, ZMOD_DIGITIZER_CAL* pUserCal);
 void    FZmodDigitizerCalConvertToS18(ZMOD_DIGITIZER_CAL adcal, ZMOD_DIGITIZER_CAL_S18 *pReturn);
+#if DPMUTIL_CFG_ZMODCAL
+BOOL    FZmodDigitizerCalGetKernel(ZMOD_DIGITIZER_CAL adcal, BYTE ihz, BYTE ch, ZMOD_CAL_KERNEL* pkern);
+#endif
 float   FZmodDigitizerGetFrequencyStepMHz(BYTE hz);
 
 /* ------------------------------------------------------------ */
@@ -66,16 +66,6 @@
 /*                  Miscellaneous Declarations                  */
 /* ------------------------------------------------------------ */
 
-/* The following addresses are utilized to retrieve information
-** from Digilent SYZYGY pods (ZMODs).
-*/
-#define addrPdid			0x80FC
-
-/* The following macro can be utilized to convert a Digilent PDID
-** into a product.
-*/
-#define ProductFromPdid(pdid)   ((pdid >> 20) & 0xFFF)
-
 /* ------------------------------------------------------------ */
 /*                  Local Type Definitions                      */
 /* ------------------------------------------------------------ */
@@ -129,147 +119,149 @@ dpmutilFGetInfo(dpmutildevInfo_t* pDevInfo) {
 	WORD					wTemp;
 	BYTE					i;
 
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 #if defined(__linux__)
 
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
 	/* Read and display the PDID.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrPDID, (BYTE*)(&pDevInfo->pdid), 4, NULL) ) {
-		printf("ERROR: failed to read PDID\n");
+		DpmPrintf("ERROR: failed to read PDID\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("PMCU_PDID:                       0x%08X\n", (unsigned int)pDevInfo->pdid);
+	DpmVerbose("PMCU_PDID:                       0x%08X\n", (unsigned int)pDevInfo->pdid);
 
 	/* Read and display the firmware revision number.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrFirmwareVersion, (BYTE*)(&wTemp), 2, NULL) ) {
-		printf("ERROR: failed to read FIRMWARE_VERSION register\n");
+		DpmPrintf("ERROR: failed to read FIRMWARE_VERSION register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("PMCU_FIRMWARE_VERSION:           %d.%d\n", wTemp >> 8, wTemp & 0xFF);
+	DpmVerbose("PMCU_FIRMWARE_VERSION:           %d.%d\n", wTemp >> 8, wTemp & 0xFF);
 	pDevInfo->fwVer = wTemp / (1<<8);
 
 	/* Read and display the configuration revision number.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrConfigurationVersion, (BYTE*)(&wTemp), 2, NULL) ) {
-		printf("ERROR: failed to read CONFIGURATION_VERSION register\n");
+		DpmPrintf("ERROR: failed to read CONFIGURATION_VERSION register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("PMCU_CONFIGURATION_VERSION:      %d.%d\n", wTemp >> 8, wTemp & 0xFF);
+	DpmVerbose("PMCU_CONFIGURATION_VERSION:      %d.%d\n", wTemp >> 8, wTemp & 0xFF);
 	pDevInfo->cfgVer = wTemp / (1<<8);
 
 	/* Read and display the platform configuration.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrPlatformConfig, (BYTE*)(&pDevInfo->platcfg), 2, NULL) ) {
-		printf("ERROR: failed to read PLATFORM_CONFIGURATION register\n");
+		DpmPrintf("ERROR: failed to read PLATFORM_CONFIGURATION register\n");
 		goto lErrorExit;
 	}
 
 	if(dpmutilfVerbose){
 		memcpy(&wTemp, &(pDevInfo->platcfg), 2);
-		printf("PLATFORM_CONFIGURATION:          0x%04X\n", wTemp);
-		printf("    ENFORCE_5V0_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce5v0CurLimit ? 'Y':'N');
-		printf("    ENFORCE_3V3_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce3v3CurLimit ? 'Y':'N');
-		printf("    ENFORCE_VIO_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforceVioCurLimit ? 'Y':'N');
-		printf("    PERFORM_SYZYGY_CRC_CHECK     [%c]\n", pDevInfo->platcfg.fPerformCrcCheck ? 'Y':'N');
+		DpmPrintf("PLATFORM_CONFIGURATION:          0x%04X\n", wTemp);
+		DpmPrintf("    ENFORCE_5V0_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce5v0CurLimit ? 'Y':'N');
+		DpmPrintf("    ENFORCE_3V3_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce3v3CurLimit ? 'Y':'N');
+		DpmPrintf("    ENFORCE_VIO_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforceVioCurLimit ? 'Y':'N');
+		DpmPrintf("    PERFORM_SYZYGY_CRC_CHECK     [%c]\n", pDevInfo->platcfg.fPerformCrcCheck ? 'Y':'N');
 	}
 
 	/* Read and display the SmartVio port count.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrPortCount, &pDevInfo->cntVioPort, 1, NULL) ) {
-		printf("ERROR: failed to read SMARTVIO_PORT_COUNT register\n");
+		DpmPrintf("ERROR: failed to read SMARTVIO_PORT_COUNT register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("SMARTVIO_PORT_COUNT:             %d\n", pDevInfo->cntVioPort);
+	DpmVerbose("SMARTVIO_PORT_COUNT:             %d\n", pDevInfo->cntVioPort);
 
 	/* Read and display the 5V0 group count.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddr5v0GroupCount, &pDevInfo->cnt5v0, 1, NULL) ) {
-		printf("ERROR: failed to read 5V0_GROUP_COUNT register\n");
+		DpmPrintf("ERROR: failed to read 5V0_GROUP_COUNT register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("5V0_GROUP_COUNT:                 %d\n", pDevInfo->cnt5v0);
+	DpmVerbose("5V0_GROUP_COUNT:                 %d\n", pDevInfo->cnt5v0);
 
 	/* Read and display the 3V3 group count.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddr3v3GroupCount, &pDevInfo->cnt3v3, 1, NULL) ) {
-		printf("ERROR: failed to read 3V3_GROUP_COUNT register\n");
+		DpmPrintf("ERROR: failed to read 3V3_GROUP_COUNT register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("3V3_GROUP_COUNT:                 %d\n", pDevInfo->cnt3v3);
+	DpmVerbose("3V3_GROUP_COUNT:                 %d\n", pDevInfo->cnt3v3);
 
 	/* Read and display the VADJ group count.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjGroupCount, &pDevInfo->cntVadj, 1, NULL) ) {
-		printf("ERROR: failed to read VADJ_GROUP_COUNT register\n");
+		DpmPrintf("ERROR: failed to read VADJ_GROUP_COUNT register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("VADJ_GROUP_COUNT:                %d\n", pDevInfo->cntVadj);
+	DpmVerbose("VADJ_GROUP_COUNT:                %d\n", pDevInfo->cntVadj);
 
 	/* Read and display the temperature probe count.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrTempProbeCount, &pDevInfo->cntProbe, 1, NULL) ) {
-		printf("ERROR: failed to read TEMPERATURE_PROBE_COUNT register\n");
+		DpmPrintf("ERROR: failed to read TEMPERATURE_PROBE_COUNT register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("TEMPERATURE_PROBE_COUNT:         %d\n", pDevInfo->cntProbe);
+	DpmVerbose("TEMPERATURE_PROBE_COUNT:         %d\n", pDevInfo->cntProbe);
 
 	for ( i = 0; i < pDevInfo->cntProbe; i++ ) {
 
 		/* Read and display this temperature probe's capabilities.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrTemp1Attributes + (offsetTemperatureReg*i), (BYTE*)&pDevInfo->probeAttr[i], 1, NULL) ) {
-			printf("ERROR: failed to read TEMPERATURE_%d_ATTRIBUTES register\n", i+1);
+			DpmPrintf("ERROR: failed to read TEMPERATURE_%d_ATTRIBUTES register\n", i+1);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-			printf("    TEMPERATURE_%d_CAPABILITIES:  0x%02X\n", i + 1, pDevInfo->probeAttr[i].fs);
-			printf("        PRESENT                  [%c]\n", pDevInfo->probeAttr[i].fPresent ? 'Y' : 'N');
-			printf("        LOCATION                 ");
+			DpmPrintf("    TEMPERATURE_%d_CAPABILITIES:  0x%02X\n", i + 1, pDevInfo->probeAttr[i].fs);
+			DpmPrintf("        PRESENT                  [%c]\n", pDevInfo->probeAttr[i].fPresent ? 'Y' : 'N');
+			DpmPrintf("        LOCATION                 ");
 			switch ( pDevInfo->probeAttr[i].tlocation ) {
 				case tlocationFpgaCpu1:
-					printf("FPGA/CPU_1\n");
+					DpmPrintf("FPGA/CPU_1\n");
 					break;
 				case tlocationFpgaCpu2:
-					printf("FPGA/CPU_2\n");
+					DpmPrintf("FPGA/CPU_2\n");
 					break;
 				case tlocationExternal1:
-					printf("EXTERNAL_1\n");
+					DpmPrintf("EXTERNAL_1\n");
 					break;
 				case tlocationExternal2:
-					printf("EXTERNAL_2\n");
+					DpmPrintf("EXTERNAL_2\n");
 					break;
 				default:
-					printf("UNKNOWN\n");
+					DpmPrintf("UNKNOWN\n");
 					break;
 			}
-			printf("        TEMPERATURE_FORMAT       ");
+			DpmPrintf("        TEMPERATURE_FORMAT       ");
 			switch ( pDevInfo->probeAttr[i].tformat ) {
 				case tformatDegCDecimal:
-					printf("Degrees C (decimal)\n");
+					DpmPrintf("Degrees C (decimal)\n");
 					break;
 				case tformatDegCFixedPoint:
-					printf("Degrees C (fixed point)\n");
+					DpmPrintf("Degrees C (fixed point)\n");
 					break;
 				case tformatDegFDecimal:
-					printf("Degrees F (decimal)\n");
+					DpmPrintf("Degrees F (decimal)\n");
 					break;
 				case tformatDegFFixedPoint:
-					printf("Degrees F (fixed point)\n");
+					DpmPrintf("Degrees F (fixed point)\n");
 					break;
 				default:
-					printf("UNKNOWN\n");
+					DpmPrintf("UNKNOWN\n");
 					break;
 			}
 		}
@@ -277,31 +269,31 @@ dpmutilFGetInfo(dpmutildevInfo_t* pDevInfo) {
 		/* Read and display this probe's temperature.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrTemp1 + (offsetTemperatureReg*i), (BYTE*)&pDevInfo->temp[i], 2, NULL) ) {
-			printf("ERROR: failed to read TEMPERATURE_%d register\n", i+1);
+			DpmPrintf("ERROR: failed to read TEMPERATURE_%d register\n", i+1);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-			printf("    TEMPERATURE_%d:               ", i + 1);
+			DpmPrintf("    TEMPERATURE_%d:               ", i + 1);
 			switch ( pDevInfo->probeAttr[i].tformat ) {
 				case tformatDegCDecimal:
-					printf("%hd Degrees C\n", pDevInfo->temp[i]);
+					DpmPrintf("%hd Degrees C\n", pDevInfo->temp[i]);
 					break;
 				case tformatDegCFixedPoint:
-					printf("%8.2f Degrees C\n", pDevInfo->temp[i] / 256.0);
+					DpmPrintf("%8.2f Degrees C\n", pDevInfo->temp[i] / 256.0);
 					break;
 				case tformatDegFDecimal:
-					printf("%hd Degrees F\n", pDevInfo->temp[i]);
+					DpmPrintf("%hd Degrees F\n", pDevInfo->temp[i]);
 					break;
 				case tformatDegFFixedPoint:
-					printf("%8.2f Degrees F\n", pDevInfo->temp[i] / 256.0);
+					DpmPrintf("%8.2f Degrees F\n", pDevInfo->temp[i] / 256.0);
 					break;
 				default:
-					printf("UNKNOWN\n");
+					DpmPrintf("UNKNOWN\n");
 					break;
 			}
 
 			if ( (i+1) != pDevInfo->cntProbe ) {
-				printf("\n");
+				DpmPrintf("\n");
 			}
 		}
 	}
@@ -309,90 +301,90 @@ dpmutilFGetInfo(dpmutildevInfo_t* pDevInfo) {
 	/* Read and display the fan count.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrFanCount, &pDevInfo->cntFan, 1, NULL) ) {
-		printf("ERROR: failed to read FAN_COUNT register\n");
+		DpmPrintf("ERROR: failed to read FAN_COUNT register\n");
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("FAN_COUNT:                       %d\n", pDevInfo->cntFan);
+	DpmVerbose("FAN_COUNT:                       %d\n", pDevInfo->cntFan);
 
 	for ( i = 0; i < pDevInfo->cntFan; i++ ) {
 
 		/* Read and display this fan's capabilities.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrFan1Capabilities + (offsetFanReg*i), (BYTE*)&pDevInfo->fanCapabilities[i], 1, NULL) ) {
-			printf("ERROR: failed to read FAN_%d_CAPABILITIES register\n", i+1);
+			DpmPrintf("ERROR: failed to read FAN_%d_CAPABILITIES register\n", i+1);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-			printf("    FAN_%d_CAPABILITIES:          0x%02X\n", i + 1, pDevInfo->fanCapabilities[i].fs);
-			printf("        ENABLE_AND_DISABLE       [%c]\n", pDevInfo->fanCapabilities[i].fcapEnable ? 'Y' : 'N');
-			printf("        SET_FIXED_SPEED          [%c]\n", pDevInfo->fanCapabilities[i].fcapSetSpeed ? 'Y' : 'N');
-			printf("        AUTO_SPEED_CONTROL       [%c]\n", pDevInfo->fanCapabilities[i].fcapAutoSpeed ? 'Y' : 'N');
-			printf("        MEASURE_RPM              [%c]\n", pDevInfo->fanCapabilities[i].fcapMeasureRpm ? 'Y' : 'N');
+			DpmPrintf("    FAN_%d_CAPABILITIES:          0x%02X\n", i + 1, pDevInfo->fanCapabilities[i].fs);
+			DpmPrintf("        ENABLE_AND_DISABLE       [%c]\n", pDevInfo->fanCapabilities[i].fcapEnable ? 'Y' : 'N');
+			DpmPrintf("        SET_FIXED_SPEED          [%c]\n", pDevInfo->fanCapabilities[i].fcapSetSpeed ? 'Y' : 'N');
+			DpmPrintf("        AUTO_SPEED_CONTROL       [%c]\n", pDevInfo->fanCapabilities[i].fcapAutoSpeed ? 'Y' : 'N');
+			DpmPrintf("        MEASURE_RPM              [%c]\n", pDevInfo->fanCapabilities[i].fcapMeasureRpm ? 'Y' : 'N');
 		}
 		/* Read and display this fan's configuration.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrFan1Config + (offsetFanReg*i), (BYTE*)&pDevInfo->fanConfig[i], 1, NULL) ) {
-			printf("ERROR: failed to read FAN_%d_CONFIGURATION register\n", i+1);
+			DpmPrintf("ERROR: failed to read FAN_%d_CONFIGURATION register\n", i+1);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-			printf("    FAN_%d_CONFIGURATION:         0x%02X\n", i + 1, pDevInfo->fanConfig[i].fs);
-			printf("        ENABLE                   [%c]\n", pDevInfo->fanConfig[i].fEnable ? 'Y' : 'N');
-			printf("        SPEED                    ");
+			DpmPrintf("    FAN_%d_CONFIGURATION:         0x%02X\n", i + 1, pDevInfo->fanConfig[i].fs);
+			DpmPrintf("        ENABLE                   [%c]\n", pDevInfo->fanConfig[i].fEnable ? 'Y' : 'N');
+			DpmPrintf("        SPEED                    ");
 			switch ( pDevInfo->fanConfig[i].fspeed ) {
 				case fancfgMinimumSpeed:
-					printf("MINIMUM\n");
+					DpmPrintf("MINIMUM\n");
 					break;
 				case fancfgMediumSpeed:
-					printf("MEDIUM\n");
+					DpmPrintf("MEDIUM\n");
 					break;
 				case fancfgMaximumSpeed:
-					printf("MAXIMUM\n");
+					DpmPrintf("MAXIMUM\n");
 					break;
 				case fancfgAutoSpeed:
-					printf("AUTOMATIC\n");
+					DpmPrintf("AUTOMATIC\n");
 					break;
 				default:
-					printf("UNKNOWN\n");
+					DpmPrintf("UNKNOWN\n");
 					break;
 			}
-			printf("        TEMPERATURE_SOURCE       ");
+			DpmPrintf("        TEMPERATURE_SOURCE       ");
 			switch ( pDevInfo->fanConfig[i].tempsrc ) {
 				case fancfgTempProbeNone:
-					printf("NONE\n");
+					DpmPrintf("NONE\n");
 					break;
 				case fancfgTempProbe1:
-					printf("TEMP_PROBE_1\n");
+					DpmPrintf("TEMP_PROBE_1\n");
 					break;
 				case fancfgTempProbe2:
-					printf("TEMP_PROBE_2\n");
+					DpmPrintf("TEMP_PROBE_2\n");
 					break;
 				case fancfgTempProbe3:
-					printf("TEMP_PROBE_3\n");
+					DpmPrintf("TEMP_PROBE_3\n");
 					break;
 				case fancfgTempProbe4:
-					printf("TEMP_PROBE_4\n");
+					DpmPrintf("TEMP_PROBE_4\n");
 					break;
 				default:
-					printf("UNKNOWN\n");
+					DpmPrintf("UNKNOWN\n");
 					break;
 			}
 
-			printf("        MEASURE_RPM              [%c]\n", pDevInfo->fanCapabilities[i].fcapMeasureRpm ? 'Y' : 'N');
+			DpmPrintf("        MEASURE_RPM              [%c]\n", pDevInfo->fanCapabilities[i].fcapMeasureRpm ? 'Y' : 'N');
 		}
 
 		/* Read and display this fan's RPM.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrFan1Rpm + (offsetFanReg*i), (BYTE*)(&pDevInfo->fanRPM[i]), 2, NULL) ) {
-			printf("ERROR: failed to read FAN_%d_RPM register\n", i+1);
+			DpmPrintf("ERROR: failed to read FAN_%d_RPM register\n", i+1);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-			printf("    FAN_%d_RPM:                   %d\n", i+1, pDevInfo->fanRPM[i]);
+			DpmPrintf("    FAN_%d_RPM:                   %d\n", i+1, pDevInfo->fanRPM[i]);
 
 
 			if ( (i+1) != pDevInfo->cntFan ) {
-				printf("\n");
+				DpmPrintf("\n");
 			}
 		}
 	}
@@ -403,6 +395,7 @@ dpmutilFGetInfo(dpmutildevInfo_t* pDevInfo) {
 	close(fdI2c);
 #endif
 
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -411,10 +404,12 @@ lErrorExit:
 		close(fdI2c);
 	}
 #endif
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
 
 
+#if DPMUTIL_CFG_POWER
 /* ------------------------------------------------------------ */
 /***    dpmutilFGetInfoPower
 **
@@ -445,24 +440,27 @@ dpmutilFGetInfoPower(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 
 	BOOL	fRet;
 
+	DpmProbe1(api__entry, __func__);
+
 	fRet = fTrue;
 
 	if ( ! dpmutilFGetInfo5V0(chanid, pPowerInfo) ) {
 		fRet = fFalse;
 	}
 
-	if(dpmutilfVerbose)printf("\n");
+	DpmVerbose("\n");
 
 	if ( ! dpmutilFGetInfo3V3(chanid, pPowerInfo) ) {
 		fRet = fFalse;
 	}
 
-	if(dpmutilfVerbose)printf("\n");
+	DpmVerbose("\n");
 
 	if ( ! dpmutilFGetInfoVio(chanid, pPowerInfo) ) {
 		fRet = fFalse;
 	}
 
+	DpmProbe2(api__return, __func__, fRet);
 	return fRet;
 }
 
@@ -500,30 +498,32 @@ dpmutilFGetInfo5V0(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 	BYTE			csupply;
 	BYTE			isupply;
 
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
 	/* Determine how many 5V0 supplies there are.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddr5v0GroupCount, &csupply, 1, NULL) ) {
-		printf("ERROR: failed to read 5V0_GROUP_COUNT register\n");
+		DpmPrintf("ERROR: failed to read 5V0_GROUP_COUNT register\n");
 		goto lErrorExit;
 	}
 
 	if ( chanid != -1 ) {
 		if ( chanid >= csupply ) {
-			printf("ERROR: device has %d 5V0 supplies. Channel %d is\n", csupply, chanid);
-			printf("not supported by this device\n");
+			DpmPrintf("ERROR: device has %d 5V0 supplies. Channel %d is\n", csupply, chanid);
+			DpmPrintf("not supported by this device\n");
 			goto lErrorExit;
 		}
 
@@ -533,10 +533,10 @@ dpmutilFGetInfo5V0(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 	else {
 		if(dpmutilfVerbose){
 			if ( 1 < csupply ) {
-				printf("Found %d 5V0 supplies\n", csupply);
+				DpmPrintf("Found %d 5V0 supplies\n", csupply);
 			}
 			else {
-				printf("Found 1 5V0 supply\n");
+				DpmPrintf("Found 1 5V0 supply\n");
 			}
 		}
 		isupply = 0;
@@ -544,28 +544,28 @@ dpmutilFGetInfo5V0(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 
 	while ( isupply < csupply ) {
 
-		if(dpmutilfVerbose)printf("Supply: 5V0_%c\n", 0x41 + isupply);
+		DpmVerbose("Supply: 5V0_%c\n", 0x41 + isupply);
 
 		/* Read and display the current allowed for the supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddr5v0ACurrentAllowed + (offset5v0Reg*isupply), (BYTE*)&pPowerInfo[isupply].currentAllowed5v0, 2, NULL) ) {
-			printf("ERROR: failed to read 5V0_%c_CURRENT_ALLOWED register\n", 0x41 + isupply);
+			DpmPrintf("ERROR: failed to read 5V0_%c_CURRENT_ALLOWED register\n", 0x41 + isupply);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    5V0_%c_CURRENT_ALLOWED:       %d mA\n", 0x41 + isupply, pPowerInfo[isupply].currentAllowed5v0);
+		DpmVerbose("    5V0_%c_CURRENT_ALLOWED:       %d mA\n", 0x41 + isupply, pPowerInfo[isupply].currentAllowed5v0);
 
 		/* Read and display the current requested for the supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddr5v0ACurrentRequested + (offset3v3Reg*isupply), (BYTE*)&pPowerInfo[isupply].currentRequested5v0, 2, NULL) ) {
-			printf("ERROR: failed to read 5V0_%c_CURRENT_REQUESTED register\n", 0x41 + isupply);
+			DpmPrintf("ERROR: failed to read 5V0_%c_CURRENT_REQUESTED register\n", 0x41 + isupply);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    5V0_%c_CURRENT_REQUESTED:     %d mA\n", 0x41 + isupply, pPowerInfo[isupply].currentRequested5v0);
+		DpmVerbose("    5V0_%c_CURRENT_REQUESTED:     %d mA\n", 0x41 + isupply, pPowerInfo[isupply].currentRequested5v0);
 
 		isupply++;
 		if(dpmutilfVerbose){
 			if ( isupply != csupply ) {
-				printf("\n");
+				DpmPrintf("\n");
 			}
 		}
 	}
@@ -576,6 +576,7 @@ dpmutilFGetInfo5V0(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 	close(fdI2c);
 #endif
 
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -585,6 +586,7 @@ lErrorExit:
 	}
 #endif
 
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
 
@@ -622,16 +624,18 @@ dpmutilFGetInfo3V3(int chanid, dpmutilPowerInfo_t pPowerinfo[]) {
 	BYTE			csupply;
 	BYTE			isupply;
 
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
@@ -639,14 +643,14 @@ dpmutilFGetInfo3V3(int chanid, dpmutilPowerInfo_t pPowerinfo[]) {
 	/* Determine how many 3V3 supplies there are.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddr3v3GroupCount, &csupply, 1, NULL) ) {
-		printf("ERROR: failed to read 3V3_GROUP_COUNT register\n");
+		DpmPrintf("ERROR: failed to read 3V3_GROUP_COUNT register\n");
 		goto lErrorExit;
 	}
 
 	if ( chanid != -1 ) {
 		if ( chanid >= csupply ) {
-			printf("ERROR: device has %d 3V3 supplies. Channel %d is\n", csupply, chanid);
-			printf("not supported by this device\n");
+			DpmPrintf("ERROR: device has %d 3V3 supplies. Channel %d is\n", csupply, chanid);
+			DpmPrintf("not supported by this device\n");
 			goto lErrorExit;
 		}
 
@@ -656,10 +660,10 @@ dpmutilFGetInfo3V3(int chanid, dpmutilPowerInfo_t pPowerinfo[]) {
 	else {
 		if(dpmutilfVerbose){
 			if ( 1 < csupply ) {
-				printf("Found %d 3V3 supplies\n", csupply);
+				DpmPrintf("Found %d 3V3 supplies\n", csupply);
 			}
 			else {
-				printf("Found 1 3V3 supply\n");
+				DpmPrintf("Found 1 3V3 supply\n");
 			}
 		}
 		isupply = 0;
@@ -667,28 +671,28 @@ dpmutilFGetInfo3V3(int chanid, dpmutilPowerInfo_t pPowerinfo[]) {
 
 	while ( isupply < csupply ) {
 
-		if(dpmutilfVerbose)printf("Supply: 3V3_%c\n", 0x41 + isupply);
+		DpmVerbose("Supply: 3V3_%c\n", 0x41 + isupply);
 
 		/* Read and display the current allowed for the supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddr3v3ACurrentAllowed + (offset3v3Reg*isupply), (BYTE*)&pPowerinfo[isupply].currentAllowed3v3, 2, NULL) ) {
-			printf("ERROR: failed to read 3V3_%c_CURRENT_ALLOWED register\n", 0x41 + isupply);
+			DpmPrintf("ERROR: failed to read 3V3_%c_CURRENT_ALLOWED register\n", 0x41 + isupply);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    3V3_%c_CURRENT_ALLOWED:       %d mA\n", 0x41 + isupply, pPowerinfo[isupply].currentAllowed3v3);
+		DpmVerbose("    3V3_%c_CURRENT_ALLOWED:       %d mA\n", 0x41 + isupply, pPowerinfo[isupply].currentAllowed3v3);
 
 		/* Read and display the current requested for the supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddr3v3ACurrentRequested + (offset3v3Reg*isupply), (BYTE*)&pPowerinfo[isupply].currentRequested3v3, 2, NULL) ) {
-			printf("ERROR: failed to read 3V3_%c_CURRENT_REQUESTED register\n", 0x41 + isupply);
+			DpmPrintf("ERROR: failed to read 3V3_%c_CURRENT_REQUESTED register\n", 0x41 + isupply);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    3V3_%c_CURRENT_REQUESTED:     %d mA\n", 0x41 + isupply, pPowerinfo[isupply].currentRequested3v3);
+		DpmVerbose("    3V3_%c_CURRENT_REQUESTED:     %d mA\n", 0x41 + isupply, pPowerinfo[isupply].currentRequested3v3);
 
 		isupply++;
 		if(dpmutilfVerbose){
 			if ( isupply != csupply ) {
-				printf("\n");
+				DpmPrintf("\n");
 			}
 		}
 	}
@@ -697,6 +701,7 @@ dpmutilFGetInfo3V3(int chanid, dpmutilPowerInfo_t pPowerinfo[]) {
 	*/
 	close(fdI2c);
 #endif
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -705,6 +710,7 @@ lErrorExit:
 		close(fdI2c);
 	}
 #endif
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
 
@@ -744,37 +750,39 @@ dpmutilFGetInfoVio(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 	BYTE			ivadj;
 	VADJ_STATUS		vadjsts;
 
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
 	/* Determine how many VADJ supplies there are.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjGroupCount, &cvadj, 1, NULL) ) {
-		printf("ERROR: failed to read VADJ_GROUP_COUNT register\n");
+		DpmPrintf("ERROR: failed to read VADJ_GROUP_COUNT register\n");
 		goto lErrorExit;
 	}
 
 	/* Get the status for all VADJ supplies.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjStatus, (BYTE*)&vadjsts, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_STATUS register\n");
+		DpmPrintf("ERROR: failed to read VADJ_STATUS register\n");
 		goto lErrorExit;
 	}
 
 	if ( chanid != -1 ) {
 		if ( chanid >= cvadj ) {
-			printf("ERROR: device has %d VIO supplies. Channel %d is\n", cvadj, chanid);
-			printf("not supported by this device\n");
+			DpmPrintf("ERROR: device has %d VIO supplies. Channel %d is\n", cvadj, chanid);
+			DpmPrintf("not supported by this device\n");
 			goto lErrorExit;
 		}
 
@@ -784,10 +792,10 @@ dpmutilFGetInfoVio(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 	else {
 		if(dpmutilfVerbose){
 			if ( 1 < cvadj ) {
-				printf("Found %d VIO supplies\n", cvadj);
+				DpmPrintf("Found %d VIO supplies\n", cvadj);
 			}
 			else {
-				printf("Found 1 VIO supply\n");
+				DpmPrintf("Found 1 VIO supply\n");
 			}
 		}
 		ivadj = 0;
@@ -796,52 +804,52 @@ dpmutilFGetInfoVio(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 	while ( ivadj < cvadj ) {
 
 		if(dpmutilfVerbose){
-			printf("Supply: VADJ_%c\n", 0x41 + ivadj);
+			DpmPrintf("Supply: VADJ_%c\n", 0x41 + ivadj);
 
-			printf("    VADJ_%c_ENABLED:              [%c]\n", 0x41 + ivadj, (vadjsts.fsEn & (1<<ivadj)) ? 'Y' : 'N');
-			printf("    VADJ_%c_POWER_GOOD:           [%c]\n", 0x41 + ivadj, (vadjsts.fsPgood & (1<<ivadj)) ? 'Y' : 'N');
+			DpmPrintf("    VADJ_%c_ENABLED:              [%c]\n", 0x41 + ivadj, (vadjsts.fsEn & (1<<ivadj)) ? 'Y' : 'N');
+			DpmPrintf("    VADJ_%c_POWER_GOOD:           [%c]\n", 0x41 + ivadj, (vadjsts.fsPgood & (1<<ivadj)) ? 'Y' : 'N');
 		}
 
 		/* Read and display the voltage setting for the current supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrVadjAVoltage + (offsetVadjReg*ivadj), (BYTE*)&pPowerInfo[ivadj].vadjVoltage, 2, NULL) ) {
-			printf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + ivadj);
+			DpmPrintf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + ivadj);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    VADJ_%c_VOLTAGE:              %d mV\n", 0x41 + ivadj, pPowerInfo[ivadj].vadjVoltage * 10);
+		DpmVerbose("    VADJ_%c_VOLTAGE:              %d mV\n", 0x41 + ivadj, pPowerInfo[ivadj].vadjVoltage * 10);
 
 		/* Read and display the current allowed for the supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrVadjACurrentAllowed + (offsetVadjReg*ivadj), (BYTE*)&pPowerInfo[ivadj].currentAllowedVadj, 2, NULL) ) {
-			printf("ERROR: failed to read VADJ_%c_CURRENT_ALLOWED register\n", 0x41 + ivadj);
+			DpmPrintf("ERROR: failed to read VADJ_%c_CURRENT_ALLOWED register\n", 0x41 + ivadj);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    VADJ_%c_CURRENT_ALLOWED:      %d mA\n", 0x41 + ivadj, pPowerInfo[ivadj].currentAllowedVadj);
+		DpmVerbose("    VADJ_%c_CURRENT_ALLOWED:      %d mA\n", 0x41 + ivadj, pPowerInfo[ivadj].currentAllowedVadj);
 
 		/* Read and display the current requested for the supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrVadjACurrentRequested + (offsetVadjReg*ivadj), (BYTE*)&pPowerInfo[ivadj].currentRequestedVadj, 2, NULL) ) {
-			printf("ERROR: failed to read VADJ_%c_CURRENT_REQUESTED register\n", 0x41 + ivadj);
+			DpmPrintf("ERROR: failed to read VADJ_%c_CURRENT_REQUESTED register\n", 0x41 + ivadj);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    VADJ_%c_CURRENT_REQUESTED:    %d mA\n", 0x41 + ivadj, pPowerInfo[ivadj].currentRequestedVadj);
+		DpmVerbose("    VADJ_%c_CURRENT_REQUESTED:    %d mA\n", 0x41 + ivadj, pPowerInfo[ivadj].currentRequestedVadj);
 
 		/* Read and display the override register for the supply.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrVadjAOverride + (offsetVadjReg*ivadj), (BYTE*)&pPowerInfo[ivadj].vadjOverride, 2, NULL) ) {
-			printf("ERROR: failed to read VADJ_%c_OVERRIDE register\n", 0x41 + ivadj);
+			DpmPrintf("ERROR: failed to read VADJ_%c_OVERRIDE register\n", 0x41 + ivadj);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-		printf("    VADJ_%c_OVERRIDE:             0x%04X\n", 0x41 + ivadj, pPowerInfo[ivadj].vadjOverride.fs);
-		printf("        ENABLE_OVERRIDE          [%c]\n", pPowerInfo[ivadj].vadjOverride.fOverride ? 'Y' : 'N');
-		printf("        ENABLE_SUPPLY            [%c]\n", pPowerInfo[ivadj].vadjOverride.fEnable ? 'Y' : 'N');
-		printf("        VOLTAGE_TO_SET           %d mV\n", pPowerInfo[ivadj].vadjOverride.vltgSet * 10);
+		DpmPrintf("    VADJ_%c_OVERRIDE:             0x%04X\n", 0x41 + ivadj, pPowerInfo[ivadj].vadjOverride.fs);
+		DpmPrintf("        ENABLE_OVERRIDE          [%c]\n", pPowerInfo[ivadj].vadjOverride.fOverride ? 'Y' : 'N');
+		DpmPrintf("        ENABLE_SUPPLY            [%c]\n", pPowerInfo[ivadj].vadjOverride.fEnable ? 'Y' : 'N');
+		DpmPrintf("        VOLTAGE_TO_SET           %d mV\n", pPowerInfo[ivadj].vadjOverride.vltgSet * 10);
 		}
 		ivadj++;
 		if(dpmutilfVerbose){
 			if ( ivadj != cvadj ) {
-				printf("\n");
+				DpmPrintf("\n");
 			}
 		}
 	}
@@ -851,6 +859,7 @@ dpmutilFGetInfoVio(int chanid, dpmutilPowerInfo_t pPowerInfo[]) {
 	*/
 	close(fdI2c);
 #endif
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -859,8 +868,10 @@ lErrorExit:
 		close(fdI2c);
 	}
 #endif
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
+#endif /* DPMUTIL_CFG_POWER */
 
 
 /* ------------------------------------------------------------ */
@@ -891,100 +902,109 @@ dpmutilFEnum(BOOL setCrcCheck, BOOL crcCheck, dpmutilPortInfo_t pPortInfo[]) {
 	int				fdI2c;
 	BYTE			csvioPorts;
 	BYTE			isvioPort;
+#if DPMUTIL_CFG_PRINT
 	VADJ_STATUS		vadjsts;
 	SzgStdFwRegs	szgstdfwRegs;
 	SzgDnaHeader	szgdnaHeader;
 	SzgDnaStrings	szgdnaStrings;
 	DWORD			pdid;
+#endif
+
+	DpmProbe1(api__entry, __func__);
 
 	fdI2c = -1;
+#if DPMUTIL_CFG_PRINT
 	memset(&szgdnaStrings, 0, sizeof(SzgDnaStrings));
+#endif
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
 
-	/* Get the status for all VADJ supplies.
+#if DPMUTIL_CFG_PRINT
+	/* Get the status for all VADJ supplies. The status is only used
+	** to display the port, so it isn't read when output is disabled.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjStatus, (BYTE*)&vadjsts, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_STATUS register\n");
+		DpmPrintf("ERROR: failed to read VADJ_STATUS register\n");
 		goto lErrorExit;
 	}
+#endif
 
 	/* Determine how many SmartVIO ports the board contains.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrPortCount, &csvioPorts, 1, NULL) ) {
-		printf("ERROR: failed to read SMART_VIO_PORT_COUNT register\n");
+		DpmPrintf("ERROR: failed to read SMART_VIO_PORT_COUNT register\n");
 		goto lErrorExit;
 	}
 
-	if(dpmutilfVerbose)printf("Found %d SmartVIO port(s)\n", csvioPorts);
+	DpmVerbose("Found %d SmartVIO port(s)\n", csvioPorts);
 
 	for ( isvioPort = 0; isvioPort < csvioPorts; isvioPort++ ) {
 
-		if(dpmutilfVerbose)printf("\nPort: %c\n", 0x41 + isvioPort);
+		DpmVerbose("\nPort: %c\n", 0x41 + isvioPort);
 
 		/* Read and display the I2C address for this port.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrPortAI2cAddress + (offsetPortReg*isvioPort), &pPortInfo[isvioPort].i2cAddr, 1, NULL) ) {
-			printf("ERROR: failed to read PORT_%c_I2C_ADDRESS register\n", 0x41 + isvioPort);
+			DpmPrintf("ERROR: failed to read PORT_%c_I2C_ADDRESS register\n", 0x41 + isvioPort);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    PORT_%c_I2C_ADDRESS:    0x%02X\n", 0x41 + isvioPort, pPortInfo[isvioPort].i2cAddr);
+		DpmVerbose("    PORT_%c_I2C_ADDRESS:    0x%02X\n", 0x41 + isvioPort, pPortInfo[isvioPort].i2cAddr);
 
 		/* Read and display the 5V0 group for this port.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrPortA5v0Group + (offsetPortReg*isvioPort), &pPortInfo[isvioPort].group5v0, 1, NULL) ) {
-			printf("ERROR: failed to read PORT_%c_5V0_GROUP register\n", 0x41 + isvioPort);
+			DpmPrintf("ERROR: failed to read PORT_%c_5V0_GROUP register\n", 0x41 + isvioPort);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    PORT_%c_5V0_GROUP:      %d\n", 0x41 + isvioPort, pPortInfo[isvioPort].group5v0);
+		DpmVerbose("    PORT_%c_5V0_GROUP:      %d\n", 0x41 + isvioPort, pPortInfo[isvioPort].group5v0);
 
 		/* Read and display the 3V3 group for this port.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrPortA3v3Group + (offsetPortReg*isvioPort), &pPortInfo[isvioPort].group3v3, 1, NULL) ) {
-			printf("ERROR: failed to read PORT_%c_3V3_GROUP register\n", 0x41 + isvioPort);
+			DpmPrintf("ERROR: failed to read PORT_%c_3V3_GROUP register\n", 0x41 + isvioPort);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    PORT_%c_3V3_GROUP:      %d\n", 0x41 + isvioPort, pPortInfo[isvioPort].group3v3);
+		DpmVerbose("    PORT_%c_3V3_GROUP:      %d\n", 0x41 + isvioPort, pPortInfo[isvioPort].group3v3);
 
 		/* Read and display the VIO group for this port.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrPortAVioGroup + (offsetPortReg*isvioPort), &pPortInfo[isvioPort].groupVio, 1, NULL) ) {
-			printf("ERROR: failed to read PORT_%c_VIO_GROUP register\n", 0x41 + isvioPort);
+			DpmPrintf("ERROR: failed to read PORT_%c_VIO_GROUP register\n", 0x41 + isvioPort);
 			goto lErrorExit;
 		}
-		if(dpmutilfVerbose)printf("    PORT_%c_VIO_GROUP:      %d\n", 0x41 + isvioPort, pPortInfo[isvioPort].groupVio);
+		DpmVerbose("    PORT_%c_VIO_GROUP:      %d\n", 0x41 + isvioPort, pPortInfo[isvioPort].groupVio);
 
 		/* Read and display the port type for this port.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrPortAType + (offsetPortReg*isvioPort), &pPortInfo[isvioPort].portType, 1, NULL) ) {
-			printf("ERROR: failed to read PORT_%c_I2C_ADDRESS register\n", 0x41 + isvioPort);
+			DpmPrintf("ERROR: failed to read PORT_%c_I2C_ADDRESS register\n", 0x41 + isvioPort);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-			printf("    PORT_%c_TYPE:           0x%02X (", 0x41 + isvioPort, pPortInfo[isvioPort].portType);
+			DpmPrintf("    PORT_%c_TYPE:           0x%02X (", 0x41 + isvioPort, pPortInfo[isvioPort].portType);
 			switch ( pPortInfo[isvioPort].portType ) {
 				case ptypeSyzygyStd:
-					printf("SYZYGY_STD)\n");
+					DpmPrintf("SYZYGY_STD)\n");
 					break;
 				case ptypeSyzygyTxr2:
-					printf("SYZYGY_TXR2)\n");
+					DpmPrintf("SYZYGY_TXR2)\n");
 					break;
 				case ptypeSyzygyTxr4:
-					printf("SYZYGY_TXR4)\n");
+					DpmPrintf("SYZYGY_TXR4)\n");
 					break;
 				case ptypeNone:
 				default:
-					printf("UNKNOWN)\n");
+					DpmPrintf("UNKNOWN)\n");
 					break;
 			}
 		}
@@ -992,77 +1012,81 @@ dpmutilFEnum(BOOL setCrcCheck, BOOL crcCheck, dpmutilPortInfo_t pPortInfo[]) {
 		/* Read and display the status for this port.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrPortAStatus + (offsetPortReg*isvioPort), (BYTE*)&pPortInfo[isvioPort].portSts, 1, NULL) ) {
-			printf("ERROR: failed to read PORT_%c_I2C_ADDRESS register\n", 0x41 + isvioPort);
+			DpmPrintf("ERROR: failed to read PORT_%c_I2C_ADDRESS register\n", 0x41 + isvioPort);
 			goto lErrorExit;
 		}
 		if(dpmutilfVerbose){
-			printf("    PORT_%c_STATUS:         0x%02X\n", 0x41 + isvioPort, *(BYTE*)&pPortInfo[isvioPort].portSts);
-			printf("        PRESENT            [%c]\n", pPortInfo[isvioPort].portSts.fPresent ? 'Y':'N');
-			printf("        DOUBLE_WIDE        [%c]\n", pPortInfo[isvioPort].portSts.fDW ? 'Y':'N');
-			printf("        5V0_WITHIN_LIMIT   [%c]\n", pPortInfo[isvioPort].portSts.f5v0InLimit ? 'Y':'N');
-			printf("        3V3_WITHIN_LIMIT   [%c]\n", pPortInfo[isvioPort].portSts.f3v3InLimit ? 'Y':'N');
-			printf("        VIO_WITHIN_LIMIT   [%c]\n", pPortInfo[isvioPort].portSts.fVioInLimit ? 'Y':'N');
-			printf("        ALLOW_VIO_ENABLE   [%c]\n", pPortInfo[isvioPort].portSts.fAllowVioEnable ? 'Y':'N');
+			DpmPrintf("    PORT_%c_STATUS:         0x%02X\n", 0x41 + isvioPort, *(BYTE*)&pPortInfo[isvioPort].portSts);
+			DpmPrintf("        PRESENT            [%c]\n", pPortInfo[isvioPort].portSts.fPresent ? 'Y':'N');
+			DpmPrintf("        DOUBLE_WIDE        [%c]\n", pPortInfo[isvioPort].portSts.fDW ? 'Y':'N');
+			DpmPrintf("        5V0_WITHIN_LIMIT   [%c]\n", pPortInfo[isvioPort].portSts.f5v0InLimit ? 'Y':'N');
+			DpmPrintf("        3V3_WITHIN_LIMIT   [%c]\n", pPortInfo[isvioPort].portSts.f3v3InLimit ? 'Y':'N');
+			DpmPrintf("        VIO_WITHIN_LIMIT   [%c]\n", pPortInfo[isvioPort].portSts.fVioInLimit ? 'Y':'N');
+			DpmPrintf("        ALLOW_VIO_ENABLE   [%c]\n", pPortInfo[isvioPort].portSts.fAllowVioEnable ? 'Y':'N');
 		}
 		/* Read and display the VIO voltage setting for this port.
 		*/
 		if ( ! PmcuI2cRead(fdI2c, regaddrVadjAVoltage + (offsetVadjReg*pPortInfo[isvioPort].groupVio), (BYTE*)&pPortInfo[isvioPort].voltage, 2, NULL) ) {
-			printf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + pPortInfo[isvioPort].groupVio);
+			DpmPrintf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + pPortInfo[isvioPort].groupVio);
 			goto lErrorExit;
 		}
+#if DPMUTIL_CFG_PRINT
+		/* The SYZYGY DNA and calibration of an installed pod are only
+		** retrieved in order to display them.
+		*/
 		if(dpmutilfVerbose){
 			if ( vadjsts.fsEn & (1 << pPortInfo[isvioPort].groupVio) ) {
-				printf("    PORT_%c_VIO_ENABLE:     [Y]\n", 0x41 + isvioPort);
-				printf("    PORT_%c_VOLTAGE:        %d mV\n", 0x41 + isvioPort, pPortInfo[isvioPort].voltage * 10);
+				DpmPrintf("    PORT_%c_VIO_ENABLE:     [Y]\n", 0x41 + isvioPort);
+				DpmPrintf("    PORT_%c_VOLTAGE:        %d mV\n", 0x41 + isvioPort, pPortInfo[isvioPort].voltage * 10);
 			}
 			else {
-				printf("    PORT_%c_VIO_ENABLE:     [N]\n", 0x41 + isvioPort);
-				printf("    PORT_%c_VOLTAGE:        0 mV\n", 0x41 + isvioPort);
+				DpmPrintf("    PORT_%c_VIO_ENABLE:     [N]\n", 0x41 + isvioPort);
+				DpmPrintf("    PORT_%c_VOLTAGE:        0 mV\n", 0x41 + isvioPort);
 			}
 
 			if (( pPortInfo[isvioPort].portSts.fPresent )  && ( IsSyzygyPort(pPortInfo[isvioPort].portType) )) {
 
 				if ( ! SyzygyReadStdFwRegisters(fdI2c, pPortInfo[isvioPort].i2cAddr, &szgstdfwRegs) ) {
-					printf("ERROR: failed to retrieve SYZYGY standard fw registers from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
+					DpmPrintf("ERROR: failed to retrieve SYZYGY standard fw registers from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
 					goto lErrorExit;
 				}
 
 				if ( ! SyzygyReadDNAHeader(fdI2c, pPortInfo[isvioPort].i2cAddr, &szgdnaHeader, setCrcCheck ? crcCheck : fTrue) ) {
-					printf("ERROR: failed to retrieve SYZYGY DNA header from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
+					DpmPrintf("ERROR: failed to retrieve SYZYGY DNA header from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
 					goto lErrorExit;
 				}
 
 				if ( ! SyzygyReadDNAStrings(fdI2c, pPortInfo[isvioPort].i2cAddr, &szgdnaHeader, &szgdnaStrings) ) {
-					printf("Error: failed to retrieve SYZYGY DNA strings from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
+					DpmPrintf("Error: failed to retrieve SYZYGY DNA strings from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
 					SyzygyFreeDNAStrings(&szgdnaStrings);
 					goto lErrorExit;
 				}
 
-				printf("    Manufacturer Name:     %s\n", szgdnaStrings.szManufacturerName);
-				printf("    Product Name:          %s\n", szgdnaStrings.szProductName);
-				printf("    Product Model:         %s\n", szgdnaStrings.szProductModel);
-				printf("    Product Version:       %s\n", szgdnaStrings.szProductVersion);
-				printf("    Serial Number:         %s\n", szgdnaStrings.szSerialNumber);
-				printf("    Firmware Version:      %d.%d\n", szgstdfwRegs.fwverMjr, szgstdfwRegs.fwverMin);
-				printf("    DNA Version:           %d.%d\n", szgstdfwRegs.dnaverMjr, szgstdfwRegs.dnaverMin);
-				printf("    Maximum 5V Load:       %d mA\n", szgdnaHeader.crntRequired5v0);
-				printf("    Maximum 3.3V Load:     %d mA\n", szgdnaHeader.crntRequired3v3);
-				printf("    Maximum VIO Load:      %d mA\n", szgdnaHeader.crntRequiredVio);
-				printf("    Voltage Range 1:       %d to %d mV\n", szgdnaHeader.vltgRange1Min * 10, szgdnaHeader.vltgRange1Max * 10);
-				printf("    Voltage Range 2:       %d to %d mV\n", szgdnaHeader.vltgRange2Min * 10, szgdnaHeader.vltgRange2Max * 10);
-				printf("    Voltage Range 3:       %d to %d mV\n", szgdnaHeader.vltgRange3Min * 10, szgdnaHeader.vltgRange3Max * 10);
-				printf("    Voltage Range 4:       %d to %d mV\n", szgdnaHeader.vltgRange4Min * 10, szgdnaHeader.vltgRange4Max * 10);
-				printf("    Attribute Flags:       0x%04X\n", szgdnaHeader.fsAttributes);
-				printf("        IS_LVDS            [%c]\n", szgdnaHeader.fsAttributes & sattrLvds ? 'Y' : 'N');
-				printf("        IS_DOUBLEWIDE      [%c]\n", szgdnaHeader.fsAttributes & sattrDoubleWide ? 'Y' : 'N');
-				printf("        IS_TXR4            [%c]\n", szgdnaHeader.fsAttributes & sattrTxr4 ? 'Y' : 'N');
+				DpmPrintf("    Manufacturer Name:     %s\n", szgdnaStrings.szManufacturerName);
+				DpmPrintf("    Product Name:          %s\n", szgdnaStrings.szProductName);
+				DpmPrintf("    Product Model:         %s\n", szgdnaStrings.szProductModel);
+				DpmPrintf("    Product Version:       %s\n", szgdnaStrings.szProductVersion);
+				DpmPrintf("    Serial Number:         %s\n", szgdnaStrings.szSerialNumber);
+				DpmPrintf("    Firmware Version:      %d.%d\n", szgstdfwRegs.fwverMjr, szgstdfwRegs.fwverMin);
+				DpmPrintf("    DNA Version:           %d.%d\n", szgstdfwRegs.dnaverMjr, szgstdfwRegs.dnaverMin);
+				DpmPrintf("    Maximum 5V Load:       %d mA\n", szgdnaHeader.crntRequired5v0);
+				DpmPrintf("    Maximum 3.3V Load:     %d mA\n", szgdnaHeader.crntRequired3v3);
+				DpmPrintf("    Maximum VIO Load:      %d mA\n", szgdnaHeader.crntRequiredVio);
+				DpmPrintf("    Voltage Range 1:       %d to %d mV\n", szgdnaHeader.vltgRange1Min * 10, szgdnaHeader.vltgRange1Max * 10);
+				DpmPrintf("    Voltage Range 2:       %d to %d mV\n", szgdnaHeader.vltgRange2Min * 10, szgdnaHeader.vltgRange2Max * 10);
+				DpmPrintf("    Voltage Range 3:       %d to %d mV\n", szgdnaHeader.vltgRange3Min * 10, szgdnaHeader.vltgRange3Max * 10);
+				DpmPrintf("    Voltage Range 4:       %d to %d mV\n", szgdnaHeader.vltgRange4Min * 10, szgdnaHeader.vltgRange4Max * 10);
+				DpmPrintf("    Attribute Flags:       0x%04X\n", szgdnaHeader.fsAttributes);
+				DpmPrintf("        IS_LVDS            [%c]\n", szgdnaHeader.fsAttributes & sattrLvds ? 'Y' : 'N');
+				DpmPrintf("        IS_DOUBLEWIDE      [%c]\n", szgdnaHeader.fsAttributes & sattrDoubleWide ? 'Y' : 'N');
+				DpmPrintf("        IS_TXR4            [%c]\n", szgdnaHeader.fsAttributes & sattrTxr4 ? 'Y' : 'N');
 
 				if ( 0 == strncmp(szgdnaStrings.szManufacturerName, "Digilent", strlen("Digilent")) ) {
 					if ( ! SyzygyI2cRead(fdI2c, pPortInfo[isvioPort].i2cAddr, addrPdid, (BYTE*)&pdid, 4, NULL) ) {
-						printf("Error: failed to read PDID from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
+						DpmPrintf("Error: failed to read PDID from 0x%02X\n", pPortInfo[isvioPort].i2cAddr);
 						goto lErrorExit;
 					}
-					printf("    PDID:                  0x%08X\n", (unsigned int)pdid);
+					DpmPrintf("    PDID:                  0x%08X\n", (unsigned int)pdid);
 
 					/* Output additional information (if available) based on the
 					** product number of the installed module.
@@ -1089,6 +1113,7 @@ dpmutilFEnum(BOOL setCrcCheck, BOOL crcCheck, dpmutilPortInfo_t pPortInfo[]) {
 				SyzygyFreeDNAStrings(&szgdnaStrings);
 			}
 		}
+#endif
 	}
 
 #if defined(__linux__)
@@ -1096,6 +1121,7 @@ dpmutilFEnum(BOOL setCrcCheck, BOOL crcCheck, dpmutilPortInfo_t pPortInfo[]) {
 	*/
 	close(fdI2c);
 #endif
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -1104,11 +1130,15 @@ lErrorExit:
 		close(fdI2c);
 	}
 #endif
+#if DPMUTIL_CFG_PRINT
 	SyzygyFreeDNAStrings(&szgdnaStrings);
+#endif
 
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
 
+#if DPMUTIL_CFG_SET
 /* ------------------------------------------------------------ */
 /***    dpmutilFSetPlatformConfig
 **
@@ -1174,6 +1204,8 @@ dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL e
 #if defined(__linux__)
 	struct timespec		tsWait;
 #endif
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 
 	/* Make sure the user passed in a parameter specifying the value to
@@ -1184,22 +1216,22 @@ dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL e
 		( ! setEnforce3v3) &&
 		( ! setEnforceVio) &&
 		( ! setCrcCheck )) {
-		printf("ERROR: you must specify one or more field to set in the\n");
-		printf("platform configuration register. Use the \"-enforce5v0\",\n");
-		printf("\"-enforce3v3\", \"-enforcevio\", and \"-checkcrc\" options\n");
-		printf("to specify the field to set.\n");
+		DpmPrintf("ERROR: you must specify one or more field to set in the\n");
+		DpmPrintf("platform configuration register. Use the \"-enforce5v0\",\n");
+		DpmPrintf("\"-enforce3v3\", \"-enforcevio\", and \"-checkcrc\" options\n");
+		DpmPrintf("to specify the field to set.\n");
 		goto lErrorExit;
 	}
 
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
@@ -1207,16 +1239,16 @@ dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL e
 	/* Read and display the platform configuration register.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrPlatformConfig, (BYTE*)(&pDevInfo->platcfg), 2, NULL) ) {
-		printf("ERROR: failed to read PLATFORM_CONFIGURATION register\n");
+		DpmPrintf("ERROR: failed to read PLATFORM_CONFIGURATION register\n");
 		goto lErrorExit;
 	}
 
 	if(dpmutilfVerbose){
-		printf("Existing PLATFORM_CONFIGURATION: 0x%04X\n", *(WORD*)&(pDevInfo->platcfg));
-		printf("    ENFORCE_5V0_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce5v0CurLimit ? 'Y':'N');
-		printf("    ENFORCE_3V3_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce3v3CurLimit ? 'Y':'N');
-		printf("    ENFORCE_VIO_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforceVioCurLimit ? 'Y':'N');
-		printf("    PERFORM_SYZYGY_CRC_CHECK     [%c]\n", pDevInfo->platcfg.fPerformCrcCheck ? 'Y':'N');
+		DpmPrintf("Existing PLATFORM_CONFIGURATION: 0x%04X\n", *(WORD*)&(pDevInfo->platcfg));
+		DpmPrintf("    ENFORCE_5V0_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce5v0CurLimit ? 'Y':'N');
+		DpmPrintf("    ENFORCE_3V3_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforce3v3CurLimit ? 'Y':'N');
+		DpmPrintf("    ENFORCE_VIO_CURRENT_LIMIT    [%c]\n", pDevInfo->platcfg.fEnforceVioCurLimit ? 'Y':'N');
+		DpmPrintf("    PERFORM_SYZYGY_CRC_CHECK     [%c]\n", pDevInfo->platcfg.fPerformCrcCheck ? 'Y':'N');
 	}
 
 	/* Update the fields of the platform configuration register based on
@@ -1238,7 +1270,7 @@ dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL e
 	/* Attempt to write the new configuration to the PMCU.
 	*/
 	if ( ! PmcuI2cWrite(fdI2c, regaddrPlatformConfig, (BYTE*)(&pDevInfo->platcfg), 2, NULL) ) {
-		printf("ERROR: failed to write PLATFORM_CONFIGURATION register\n");
+		DpmPrintf("ERROR: failed to write PLATFORM_CONFIGURATION register\n");
 		goto lErrorExit;
 	}
 
@@ -1260,7 +1292,7 @@ dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL e
 	/* Read and display the platform configuration register.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrPlatformConfig, (BYTE*)(&wTemp), 2, NULL) ) {
-		printf("ERROR: failed to read PLATFORM_CONFIGURATION register 2\n");
+		DpmPrintf("ERROR: failed to read PLATFORM_CONFIGURATION register 2\n");
 		goto lErrorExit;
 	}
 	ppcfg = (PLATFORM_CONFIG*)(&wTemp);
@@ -1268,16 +1300,16 @@ dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL e
 	/* Display the new configuration.
 	*/
 	if(dpmutilfVerbose){
-		printf("\nNew PLATFORM_CONFIGURATION:      0x%04X\n", wTemp);
-		printf("    ENFORCE_5V0_CURRENT_LIMIT    [%c]\n", ppcfg->fEnforce5v0CurLimit ? 'Y':'N');
-		printf("    ENFORCE_3V3_CURRENT_LIMIT    [%c]\n", ppcfg->fEnforce3v3CurLimit ? 'Y':'N');
-		printf("    ENFORCE_VIO_CURRENT_LIMIT    [%c]\n", ppcfg->fEnforceVioCurLimit ? 'Y':'N');
-		printf("    PERFORM_SYZYGY_CRC_CHECK     [%c]\n", ppcfg->fPerformCrcCheck ? 'Y':'N');
+		DpmPrintf("\nNew PLATFORM_CONFIGURATION:      0x%04X\n", wTemp);
+		DpmPrintf("    ENFORCE_5V0_CURRENT_LIMIT    [%c]\n", ppcfg->fEnforce5v0CurLimit ? 'Y':'N');
+		DpmPrintf("    ENFORCE_3V3_CURRENT_LIMIT    [%c]\n", ppcfg->fEnforce3v3CurLimit ? 'Y':'N');
+		DpmPrintf("    ENFORCE_VIO_CURRENT_LIMIT    [%c]\n", ppcfg->fEnforceVioCurLimit ? 'Y':'N');
+		DpmPrintf("    PERFORM_SYZYGY_CRC_CHECK     [%c]\n", ppcfg->fPerformCrcCheck ? 'Y':'N');
 	}
 
 	if ( *(WORD*)&pDevInfo->platcfg != wTemp ) {
-		printf("ERROR: new platform configuration (0x%04X) does\n", *(WORD*)&pDevInfo->platcfg);
-		printf("not match specified configuration (0x%04X)\n", wTemp);
+		DpmPrintf("ERROR: new platform configuration (0x%04X) does\n", *(WORD*)&pDevInfo->platcfg);
+		DpmPrintf("not match specified configuration (0x%04X)\n", wTemp);
 		goto lErrorExit;
 	}
 
@@ -1286,6 +1318,7 @@ dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL e
 	*/
 	close(fdI2c);
 #endif
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -1294,6 +1327,7 @@ lErrorExit:
 		close(fdI2c);
 	}
 #endif
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
 
@@ -1357,12 +1391,14 @@ dpmutilFSetVioConfig(int chanid, BOOL setEnable, BOOL enable, BOOL setOverride,
 	struct timespec		tsWait;
 #endif
 
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 
 	/* Make sure the user specified the channel ID.
 	*/
 	if ( chanid < 0 ) {
-		printf("ERROR: you must specify a channel identifier using the \"-chanid\" option\n");
+		DpmPrintf("ERROR: you must specify a channel identifier using the \"-chanid\" option\n");
 		goto lErrorExit;
 	}
 
@@ -1371,21 +1407,21 @@ dpmutilFSetVioConfig(int chanid, BOOL setEnable, BOOL enable, BOOL setOverride,
 	** there is nothing to do.
 	*/
 	if (( ! setEnable ) && ( ! setOverride ) && ( ! setVoltage )) {
-		printf("ERROR: you must specify one or more field to set. Use\n");
-		printf("the \"-override\", \"-enable\", and \"-voltage\" options to \n");
-		printf("specify the field to set.\n");
+		DpmPrintf("ERROR: you must specify one or more field to set. Use\n");
+		DpmPrintf("the \"-override\", \"-enable\", and \"-voltage\" options to \n");
+		DpmPrintf("specify the field to set.\n");
 		goto lErrorExit;
 	}
 
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
@@ -1393,48 +1429,48 @@ dpmutilFSetVioConfig(int chanid, BOOL setEnable, BOOL enable, BOOL setOverride,
 	/* Determine how many VADJ supplies there are.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjGroupCount, &cvadj, 1, NULL) ) {
-		printf("ERROR: failed to read VADJ_GROUP_COUNT register\n");
+		DpmPrintf("ERROR: failed to read VADJ_GROUP_COUNT register\n");
 		goto lErrorExit;
 	}
 
 	/* Make sure the specified channel is supported by this device.
 	*/
 	if ( chanid >= cvadj ) {
-		printf("ERROR: device has %d VIO supplies. Channel %d is\n", cvadj, chanid);
-		printf("not supported by this device\n");
+		DpmPrintf("ERROR: device has %d VIO supplies. Channel %d is\n", cvadj, chanid);
+		DpmPrintf("not supported by this device\n");
 		goto lErrorExit;
 	}
 
 	/* Read and display the override register for the supply.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjAOverride + (offsetVadjReg*chanid), (BYTE*)&vadjow, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_%c_OVERRIDE register\n", 0x41 + chanid);
+		DpmPrintf("ERROR: failed to read VADJ_%c_OVERRIDE register\n", 0x41 + chanid);
 		goto lErrorExit;
 	}
 	if(dpmutilfVerbose){
-		printf("Existing VADJ_%c_OVERRIDE:    0x%04X\n", 0x41 + chanid, vadjow.fs);
-		printf("    ENABLE_OVERRIDE          [%c]\n", vadjow.fOverride ? 'Y' : 'N');
-		printf("    ENABLE_SUPPLY            [%c]\n", vadjow.fEnable ? 'Y' : 'N');
-		printf("    VOLTAGE_TO_SET           %d mV\n", vadjow.vltgSet * 10);
+		DpmPrintf("Existing VADJ_%c_OVERRIDE:    0x%04X\n", 0x41 + chanid, vadjow.fs);
+		DpmPrintf("    ENABLE_OVERRIDE          [%c]\n", vadjow.fOverride ? 'Y' : 'N');
+		DpmPrintf("    ENABLE_SUPPLY            [%c]\n", vadjow.fEnable ? 'Y' : 'N');
+		DpmPrintf("    VOLTAGE_TO_SET           %d mV\n", vadjow.vltgSet * 10);
 	}
 
 	/* Read and display the voltage register for the supply.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjAVoltage + (offsetVadjReg*chanid), (BYTE*)&wTemp, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + chanid);
+		DpmPrintf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + chanid);
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("Existing VADJ_%c_VOLTAGE:     %d mV\n", 0x41 + chanid, wTemp * 10);
+	DpmVerbose("Existing VADJ_%c_VOLTAGE:     %d mV\n", 0x41 + chanid, wTemp * 10);
 
 	/* Get and display the status for this supply.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjStatus, (BYTE*)&vadjsts, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_STATUS register\n");
+		DpmPrintf("ERROR: failed to read VADJ_STATUS register\n");
 		goto lErrorExit;
 	}
 	if(dpmutilfVerbose){
-		printf("VADJ_%c_ENABLED:              [%c]\n", 0x41 + chanid, (vadjsts.fsEn & (1<<chanid)) ? 'Y' : 'N');
-		printf("VADJ_%c_POWER_GOOD:           [%c]\n", 0x41 + chanid, (vadjsts.fsPgood & (1<<chanid)) ? 'Y' : 'N');
+		DpmPrintf("VADJ_%c_ENABLED:              [%c]\n", 0x41 + chanid, (vadjsts.fsEn & (1<<chanid)) ? 'Y' : 'N');
+		DpmPrintf("VADJ_%c_POWER_GOOD:           [%c]\n", 0x41 + chanid, (vadjsts.fsPgood & (1<<chanid)) ? 'Y' : 'N');
 	}
 
 	/* Update the fields of the override register to reflect the settings
@@ -1453,16 +1489,16 @@ dpmutilFSetVioConfig(int chanid, BOOL setEnable, BOOL enable, BOOL setOverride,
 	/* Dispaly the new override settings that we intend to apply.
 	*/
 	if(dpmutilfVerbose){
-		printf("\nNew VADJ_%c_OVERRIDE:         0x%04X\n", 0x41 + chanid, vadjow.fs);
-		printf("    ENABLE_OVERRIDE          [%c]\n", vadjow.fOverride ? 'Y' : 'N');
-		printf("    ENABLE_SUPPLY            [%c]\n", vadjow.fEnable ? 'Y' : 'N');
-		printf("    VOLTAGE_TO_SET           %d mV\n", vadjow.vltgSet * 10);
+		DpmPrintf("\nNew VADJ_%c_OVERRIDE:         0x%04X\n", 0x41 + chanid, vadjow.fs);
+		DpmPrintf("    ENABLE_OVERRIDE          [%c]\n", vadjow.fOverride ? 'Y' : 'N');
+		DpmPrintf("    ENABLE_SUPPLY            [%c]\n", vadjow.fEnable ? 'Y' : 'N');
+		DpmPrintf("    VOLTAGE_TO_SET           %d mV\n", vadjow.vltgSet * 10);
 	}
 
 	/* Attempt to write the new configuration to the PMCU.
 	*/
 	if ( ! PmcuI2cWrite(fdI2c, regaddrVadjAOverride + (offsetVadjReg*chanid), (BYTE*)(&vadjow), 2, NULL) ) {
-		printf("ERROR: failed to write VADJ_%c_OVERRIDE register\n", 0x41 + chanid);
+		DpmPrintf("ERROR: failed to write VADJ_%c_OVERRIDE register\n", 0x41 + chanid);
 		goto lErrorExit;
 	}
 
@@ -1481,38 +1517,38 @@ dpmutilFSetVioConfig(int chanid, BOOL setEnable, BOOL enable, BOOL setOverride,
 	/* Read and display the new override register settings.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjAOverride + (offsetVadjReg*chanid), (BYTE*)&vadjow2, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_%c_OVERRIDE register\n", 0x41 + chanid);
+		DpmPrintf("ERROR: failed to read VADJ_%c_OVERRIDE register\n", 0x41 + chanid);
 		goto lErrorExit;
 	}
 	if(dpmutilfVerbose){
-		printf("\nActual VADJ_%c_OVERRIDE:      0x%04X\n", 0x41 + chanid, vadjow2.fs);
-		printf("    ENABLE_OVERRIDE          [%c]\n", vadjow2.fOverride ? 'Y' : 'N');
-		printf("    ENABLE_SUPPLY            [%c]\n", vadjow2.fEnable ? 'Y' : 'N');
-		printf("    VOLTAGE_TO_SET           %d mV\n", vadjow2.vltgSet * 10);
+		DpmPrintf("\nActual VADJ_%c_OVERRIDE:      0x%04X\n", 0x41 + chanid, vadjow2.fs);
+		DpmPrintf("    ENABLE_OVERRIDE          [%c]\n", vadjow2.fOverride ? 'Y' : 'N');
+		DpmPrintf("    ENABLE_SUPPLY            [%c]\n", vadjow2.fEnable ? 'Y' : 'N');
+		DpmPrintf("    VOLTAGE_TO_SET           %d mV\n", vadjow2.vltgSet * 10);
 	}
 
 	/* Read and display the voltage register for the supply.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjAVoltage + (offsetVadjReg*chanid), (BYTE*)&wTemp, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + chanid);
+		DpmPrintf("ERROR: failed to read VADJ_%c_VOLTAGE register\n", 0x41 + chanid);
 		goto lErrorExit;
 	}
-	if(dpmutilfVerbose)printf("Actual VADJ_%c_VOLTAGE:       %d mV\n", 0x41 + chanid, wTemp * 10);
+	DpmVerbose("Actual VADJ_%c_VOLTAGE:       %d mV\n", 0x41 + chanid, wTemp * 10);
 
 	/* Get and display the status for this supply.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrVadjStatus, (BYTE*)&vadjsts, 2, NULL) ) {
-		printf("ERROR: failed to read VADJ_STATUS register\n");
+		DpmPrintf("ERROR: failed to read VADJ_STATUS register\n");
 		goto lErrorExit;
 	}
 	if(dpmutilfVerbose){
-		printf("VADJ_%c_ENABLED:              [%c]\n", 0x41 + chanid, (vadjsts.fsEn & (1<<chanid)) ? 'Y' : 'N');
-		printf("VADJ_%c_POWER_GOOD:           [%c]\n", 0x41 + chanid, (vadjsts.fsPgood & (1<<chanid)) ? 'Y' : 'N');
+		DpmPrintf("VADJ_%c_ENABLED:              [%c]\n", 0x41 + chanid, (vadjsts.fsEn & (1<<chanid)) ? 'Y' : 'N');
+		DpmPrintf("VADJ_%c_POWER_GOOD:           [%c]\n", 0x41 + chanid, (vadjsts.fsPgood & (1<<chanid)) ? 'Y' : 'N');
 	}
 
 	if ( vadjow.fs != vadjow2.fs ) {
-		printf("ERROR: new VADJ_%c_OVERRIDE configuration (0x%04X) does\n", 0x41 + chanid, vadjow2.fs);
-		printf("not match specified configuration (0x%04X)\n", vadjow.fs);
+		DpmPrintf("ERROR: new VADJ_%c_OVERRIDE configuration (0x%04X) does\n", 0x41 + chanid, vadjow2.fs);
+		DpmPrintf("not match specified configuration (0x%04X)\n", vadjow.fs);
 		goto lErrorExit;
 	}
 
@@ -1521,6 +1557,7 @@ dpmutilFSetVioConfig(int chanid, BOOL setEnable, BOOL enable, BOOL setOverride,
 	*/
 	close(fdI2c);
 #endif
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -1530,6 +1567,7 @@ lErrorExit:
 	}
 #endif
 
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
 
@@ -1596,27 +1634,29 @@ dpmutilFSetFanConfig(int fanid, BOOL setEnable, BOOL enable, BOOL setSpeed, BYTE
 	struct timespec		tsWait;
 #endif
 
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 
 	/* Make sure the user passed in a parameter specifying the value to
 	** set for one or more fields of the FAN_n_CONFIGURATION register.
 	*/
 	if (( ! setEnable ) && ( ! setSpeed ) && ( ! setProbe )) {
-		printf("ERROR: you must specify one or more field to set. Use\n");
-		printf("the \"-enable\", \"-speed\", and \"-probe\" options to \n");
-		printf("specify the field to set.\n");
+		DpmPrintf("ERROR: you must specify one or more field to set. Use\n");
+		DpmPrintf("the \"-enable\", \"-speed\", and \"-probe\" options to \n");
+		DpmPrintf("specify the field to set.\n");
 		goto lErrorExit;
 	}
 
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
@@ -1624,79 +1664,79 @@ dpmutilFSetFanConfig(int fanid, BOOL setEnable, BOOL enable, BOOL setSpeed, BYTE
 	/* Determine how many fans the device supports.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrFanCount, &cfan, 1, NULL) ) {
-		printf("ERROR: failed to read FAN_COUNT register\n");
+		DpmPrintf("ERROR: failed to read FAN_COUNT register\n");
 		goto lErrorExit;
 	}
 
 	/* Make sure the specified fan is supported by this device.
 	*/
 	if ( fanid >= cfan ) {
-		printf("ERROR: device supports %d fans. Fan %d is\n", cfan, fanid + 1);
-		printf("not supported by this device\n");
+		DpmPrintf("ERROR: device supports %d fans. Fan %d is\n", cfan, fanid + 1);
+		DpmPrintf("not supported by this device\n");
 		goto lErrorExit;
 	}
 
 	/* Read and display this fan's capabilities.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrFan1Capabilities + (offsetFanReg*fanid), (BYTE*)&fcap, 1, NULL) ) {
-		printf("ERROR: failed to read FAN_%d_CAPABILITIES register\n", fanid+1);
+		DpmPrintf("ERROR: failed to read FAN_%d_CAPABILITIES register\n", fanid+1);
 		goto lErrorExit;
 	}
 
 	if(dpmutilfVerbose){
-		printf("FAN_%d_CAPABILITIES:              0x%02X\n", fanid + 1, fcap.fs);
-		printf("    ENABLE_AND_DISABLE           [%c]\n", fcap.fcapEnable ? 'Y' : 'N');
-		printf("    SET_FIXED_SPEED              [%c]\n", fcap.fcapSetSpeed ? 'Y' : 'N');
-		printf("    AUTO_SPEED_CONTROL           [%c]\n", fcap.fcapAutoSpeed ? 'Y' : 'N');
-		printf("    MEASURE_RPM                  [%c]\n", fcap.fcapMeasureRpm ? 'Y' : 'N');
+		DpmPrintf("FAN_%d_CAPABILITIES:              0x%02X\n", fanid + 1, fcap.fs);
+		DpmPrintf("    ENABLE_AND_DISABLE           [%c]\n", fcap.fcapEnable ? 'Y' : 'N');
+		DpmPrintf("    SET_FIXED_SPEED              [%c]\n", fcap.fcapSetSpeed ? 'Y' : 'N');
+		DpmPrintf("    AUTO_SPEED_CONTROL           [%c]\n", fcap.fcapAutoSpeed ? 'Y' : 'N');
+		DpmPrintf("    MEASURE_RPM                  [%c]\n", fcap.fcapMeasureRpm ? 'Y' : 'N');
 	}
 
 	/* Read and display this fan's configuration.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrFan1Config + (offsetFanReg*fanid), (BYTE*)&fcfg, 1, NULL) ) {
-		printf("ERROR: failed to read FAN_%d_CONFIGURATION register\n", fanid+1);
+		DpmPrintf("ERROR: failed to read FAN_%d_CONFIGURATION register\n", fanid+1);
 		goto lErrorExit;
 	}
 	if(dpmutilfVerbose){
-		printf("\nExisting FAN_%d_CONFIGURATION:    0x%02X\n", fanid + 1, fcfg.fs);
-		printf("    ENABLE                       [%c]\n", fcfg.fEnable ? 'Y' : 'N');
-		printf("    SPEED                        ");
+		DpmPrintf("\nExisting FAN_%d_CONFIGURATION:    0x%02X\n", fanid + 1, fcfg.fs);
+		DpmPrintf("    ENABLE                       [%c]\n", fcfg.fEnable ? 'Y' : 'N');
+		DpmPrintf("    SPEED                        ");
 		switch ( fcfg.fspeed ) {
 			case fancfgMinimumSpeed:
-				printf("MINIMUM\n");
+				DpmPrintf("MINIMUM\n");
 				break;
 			case fancfgMediumSpeed:
-				printf("MEDIUM\n");
+				DpmPrintf("MEDIUM\n");
 				break;
 			case fancfgMaximumSpeed:
-				printf("MAXIMUM\n");
+				DpmPrintf("MAXIMUM\n");
 				break;
 			case fancfgAutoSpeed:
-				printf("AUTOMATIC\n");
+				DpmPrintf("AUTOMATIC\n");
 				break;
 			default:
-				printf("UNKNOWN\n");
+				DpmPrintf("UNKNOWN\n");
 				break;
 		}
-		printf("    TEMPERATURE_SOURCE           ");
+		DpmPrintf("    TEMPERATURE_SOURCE           ");
 		switch ( fcfg.tempsrc ) {
 			case fancfgTempProbeNone:
-				printf("NONE\n");
+				DpmPrintf("NONE\n");
 				break;
 			case fancfgTempProbe1:
-				printf("TEMP_PROBE_1\n");
+				DpmPrintf("TEMP_PROBE_1\n");
 				break;
 			case fancfgTempProbe2:
-				printf("TEMP_PROBE_2\n");
+				DpmPrintf("TEMP_PROBE_2\n");
 				break;
 			case fancfgTempProbe3:
-				printf("TEMP_PROBE_3\n");
+				DpmPrintf("TEMP_PROBE_3\n");
 				break;
 			case fancfgTempProbe4:
-				printf("TEMP_PROBE_4\n");
+				DpmPrintf("TEMP_PROBE_4\n");
 				break;
 			default:
-				printf("UNKNOWN\n");
+				DpmPrintf("UNKNOWN\n");
 				break;
 		}
 	}
@@ -1714,45 +1754,45 @@ dpmutilFSetFanConfig(int fanid, BOOL setEnable, BOOL enable, BOOL setSpeed, BYTE
 	}
 
 	if(dpmutilfVerbose){
-		printf("\nNew FAN_%d_CONFIGURATION:         0x%02X\n", fanid + 1, fcfg.fs);
-		printf("    ENABLE                       [%c]\n", fcfg.fEnable ? 'Y' : 'N');
-		printf("    SPEED                        ");
+		DpmPrintf("\nNew FAN_%d_CONFIGURATION:         0x%02X\n", fanid + 1, fcfg.fs);
+		DpmPrintf("    ENABLE                       [%c]\n", fcfg.fEnable ? 'Y' : 'N');
+		DpmPrintf("    SPEED                        ");
 		switch ( fcfg.fspeed ) {
 			case fancfgMinimumSpeed:
-				printf("MINIMUM\n");
+				DpmPrintf("MINIMUM\n");
 				break;
 			case fancfgMediumSpeed:
-				printf("MEDIUM\n");
+				DpmPrintf("MEDIUM\n");
 				break;
 			case fancfgMaximumSpeed:
-				printf("MAXIMUM\n");
+				DpmPrintf("MAXIMUM\n");
 				break;
 			case fancfgAutoSpeed:
-				printf("AUTOMATIC\n");
+				DpmPrintf("AUTOMATIC\n");
 				break;
 			default:
-				printf("UNKNOWN\n");
+				DpmPrintf("UNKNOWN\n");
 				break;
 		}
-		printf("    TEMPERATURE_SOURCE           ");
+		DpmPrintf("    TEMPERATURE_SOURCE           ");
 		switch ( fcfg.tempsrc ) {
 			case fancfgTempProbeNone:
-				printf("NONE\n");
+				DpmPrintf("NONE\n");
 				break;
 			case fancfgTempProbe1:
-				printf("TEMP_PROBE_1\n");
+				DpmPrintf("TEMP_PROBE_1\n");
 				break;
 			case fancfgTempProbe2:
-				printf("TEMP_PROBE_2\n");
+				DpmPrintf("TEMP_PROBE_2\n");
 				break;
 			case fancfgTempProbe3:
-				printf("TEMP_PROBE_3\n");
+				DpmPrintf("TEMP_PROBE_3\n");
 				break;
 			case fancfgTempProbe4:
-				printf("TEMP_PROBE_4\n");
+				DpmPrintf("TEMP_PROBE_4\n");
 				break;
 			default:
-				printf("UNKNOWN\n");
+				DpmPrintf("UNKNOWN\n");
 				break;
 		}
 	}
@@ -1760,7 +1800,7 @@ dpmutilFSetFanConfig(int fanid, BOOL setEnable, BOOL enable, BOOL setSpeed, BYTE
 	/* Send the new fan configuration to the PMCU.
 	*/
 	if ( ! PmcuI2cWrite(fdI2c, regaddrFan1Config + (offsetFanReg*fanid), (BYTE*)&fcfg, 1, NULL) ) {
-		printf("ERROR: failed to write FAN_%d_CONFIGURATION register\n", fanid + 1);
+		DpmPrintf("ERROR: failed to write FAN_%d_CONFIGURATION register\n", fanid + 1);
 		goto lErrorExit;
 	}
 
@@ -1782,56 +1822,56 @@ dpmutilFSetFanConfig(int fanid, BOOL setEnable, BOOL enable, BOOL setSpeed, BYTE
 	/* Read and display the fan configuration that was actually set.
 	*/
 	if ( ! PmcuI2cRead(fdI2c, regaddrFan1Config + (offsetFanReg*fanid), (BYTE*)&fcfg2, 1, NULL) ) {
-		printf("ERROR: failed to read FAN_%d_CONFIGURATION register\n", fanid+1);
+		DpmPrintf("ERROR: failed to read FAN_%d_CONFIGURATION register\n", fanid+1);
 		goto lErrorExit;
 	}
 	if(dpmutilfVerbose){
-		printf("\nActual FAN_%d_CONFIGURATION:      0x%02X\n", fanid + 1, fcfg2.fs);
-		printf("    ENABLE                       [%c]\n", fcfg2.fEnable ? 'Y' : 'N');
-		printf("    SPEED                        ");
+		DpmPrintf("\nActual FAN_%d_CONFIGURATION:      0x%02X\n", fanid + 1, fcfg2.fs);
+		DpmPrintf("    ENABLE                       [%c]\n", fcfg2.fEnable ? 'Y' : 'N');
+		DpmPrintf("    SPEED                        ");
 		switch ( fcfg2.fspeed ) {
 			case fancfgMinimumSpeed:
-				printf("MINIMUM\n");
+				DpmPrintf("MINIMUM\n");
 				break;
 			case fancfgMediumSpeed:
-				printf("MEDIUM\n");
+				DpmPrintf("MEDIUM\n");
 				break;
 			case fancfgMaximumSpeed:
-				printf("MAXIMUM\n");
+				DpmPrintf("MAXIMUM\n");
 				break;
 			case fancfgAutoSpeed:
-				printf("AUTOMATIC\n");
+				DpmPrintf("AUTOMATIC\n");
 				break;
 			default:
-				printf("UNKNOWN\n");
+				DpmPrintf("UNKNOWN\n");
 				break;
 		}
-		printf("    TEMPERATURE_SOURCE           ");
+		DpmPrintf("    TEMPERATURE_SOURCE           ");
 		switch ( fcfg2.tempsrc ) {
 			case fancfgTempProbeNone:
-				printf("NONE\n");
+				DpmPrintf("NONE\n");
 				break;
 			case fancfgTempProbe1:
-				printf("TEMP_PROBE_1\n");
+				DpmPrintf("TEMP_PROBE_1\n");
 				break;
 			case fancfgTempProbe2:
-				printf("TEMP_PROBE_2\n");
+				DpmPrintf("TEMP_PROBE_2\n");
 				break;
 			case fancfgTempProbe3:
-				printf("TEMP_PROBE_3\n");
+				DpmPrintf("TEMP_PROBE_3\n");
 				break;
 			case fancfgTempProbe4:
-				printf("TEMP_PROBE_4\n");
+				DpmPrintf("TEMP_PROBE_4\n");
 				break;
 			default:
-				printf("UNKNOWN\n");
+				DpmPrintf("UNKNOWN\n");
 				break;
 		}
 	}
 
 	if ( fcfg.fs != fcfg2.fs ) {
-		printf("ERROR: new FAN_%d_CONFIGURATION (0x%02X) does\n", fanid + 1, fcfg2.fs);
-		printf("not match specified configuration (0x%02X)\n", fcfg.fs);
+		DpmPrintf("ERROR: new FAN_%d_CONFIGURATION (0x%02X) does\n", fanid + 1, fcfg2.fs);
+		DpmPrintf("not match specified configuration (0x%02X)\n", fcfg.fs);
 		goto lErrorExit;
 	}
 
@@ -1840,6 +1880,7 @@ dpmutilFSetFanConfig(int fanid, BOOL setEnable, BOOL enable, BOOL setSpeed, BYTE
 	*/
 	close(fdI2c);
 #endif
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -1849,9 +1890,12 @@ lErrorExit:
 	}
 #endif
 
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
+#endif /* DPMUTIL_CFG_SET */
 
+#if DPMUTIL_CFG_RESET
 /* ------------------------------------------------------------ */
 /***    dpmutilFResetPMCU
 **
@@ -1874,17 +1918,19 @@ dpmutilFResetPMCU() {
 	int		fdI2c;
 	BYTE	bTemp;
 
+	DpmProbe1(api__entry, __func__);
+
 	fdI2c = -1;
 
 #if defined(__linux__)
 	fdI2c = I2CHALOpenI2cController();
 	if ( 0 > fdI2c ) {
-		printf("ERROR: failed to open file descriptor for I2C device\n");
+		DpmPrintf("ERROR: failed to open file descriptor for I2C device\n");
 		goto lErrorExit;
 	}
 #else
 	if(!I2CHALInit(0)){
-		printf("ERROR: failed to initialize I2C device\n");
+		DpmPrintf("ERROR: failed to initialize I2C device\n");
 		goto lErrorExit;
 	}
 #endif
@@ -1901,17 +1947,18 @@ dpmutilFResetPMCU() {
 	*/
 	bTemp = 1;
 	if ( ! PmcuI2cWrite(fdI2c, regaddrSoftwareReset, &bTemp, 1, NULL) ) {
-		printf("ERROR: failed to write SOFTWARE_RESET register\n");
+		DpmPrintf("ERROR: failed to write SOFTWARE_RESET register\n");
 		goto lErrorExit;
 	}
 
-	if(dpmutilfVerbose)printf("Successfully sent reset command to Platform MCU!\n");
+	DpmVerbose("Successfully sent reset command to Platform MCU!\n");
 
 #if defined(__linux__)
 	/* Close the I2C controller file descriptor.
 	*/
 	close(fdI2c);
 #endif
+	DpmProbe2(api__return, __func__, fTrue);
 	return fTrue;
 
 lErrorExit:
@@ -1921,5 +1968,7 @@ lErrorExit:
 	}
 #endif
 
+	DpmProbe2(api__return, __func__, fFalse);
 	return fFalse;
 }
+#endif /* DPMUTIL_CFG_RESET */
@@ -46,10 +46,12 @@
 /* ------------------------------------------------------------ */
 /*                  Include File Definitions                    */
 /* ------------------------------------------------------------ */
+#include "dpmutilcfg.h"
 #include "I2CHAL.h"
 #include "PlatformMCU.h"
 #include "stdtypes.h"
 #include "syzygy.h"
+#include "ZmodCal.h"
 #include "ZmodADC.h"
 #include "ZmodDAC.h"
 #include "ZmodDigitizer.h"
@@ -110,13 +112,19 @@ typedef struct{
 /* ------------------------------------------------------------ */
 
 BOOL	dpmutilFGetInfo(dpmutildevInfo_t* pDevInfo);
+#if DPMUTIL_CFG_POWER
 BOOL	dpmutilFGetInfoPower(int chanid, dpmutilPowerInfo_t pPowerInfo[]);
 BOOL	dpmutilFGetInfo5V0(int chanid, dpmutilPowerInfo_t pPowerInfo[]);
 BOOL	dpmutilFGetInfo3V3(int chanid, dpmutilPowerInfo_t pPowerInfo[]);
 BOOL	dpmutilFGetInfoVio(int chanid, dpmutilPowerInfo_t pPowerInfo[]);
+#endif
 BOOL	dpmutilFEnum(BOOL setCrcCheck, BOOL crcCheck, dpmutilPortInfo_t pPortInfo[]);
+#if DPMUTIL_CFG_SET
 BOOL	dpmutilFSetPlatformConfig(dpmutildevInfo_t* pDevInfo, BOOL setEnforce5v0, BOOL enforce5v0, BOOL setEnforce3v3, BOOL enforce3v3, BOOL setEnforceVio, BOOL enforceVio, BOOL setCrcCheck, BOOL crcCheck);
 BOOL	dpmutilFSetVioConfig(int chanid, BOOL setEnable, BOOL enable, BOOL setOverride, BOOL override, BOOL setVoltage, WORD voltage);
 BOOL	dpmutilFSetFanConfig(int fanid, BOOL setEnable, BOOL enable, BOOL setSpeed, BYTE speed, BOOL setProbe, BYTE probe);
+#endif
+#if DPMUTIL_CFG_RESET
 BOOL	dpmutilFResetPMCU();
+#endif
 
@@ -0,0 +1,143 @@
+/************************************************************************/
+/*                                                                      */
+/*  dpmutilcfg.h  --  dpmutil build time feature selection              */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file selects which features are compiled into the       */
+/*  dpmutil library. Every feature is enabled unless it is disabled on  */
+/*  the compiler command line, e.g. -DDPMUTIL_CFG_PRINT=0.              */
+/*                                                                      */
+/*  Defining DPMUTIL_MINIMAL selects the footprint optimised profile    */
+/*  intended for baremetal designs with little memory: no console       */
+/*  output (and therefore no printf, sprintf or strftime), only the     */
+/*  getinfo, power and enum commands, no Zmod sample conversion and a   */
+/*  single I2C rate controller. Individual features can still be turned */
+/*  back on, e.g. -DDPMUTIL_MINIMAL -DDPMUTIL_CFG_SET=1.                */
+/*                                                                      */
+/*      DPMUTIL_CFG_PRINT   error and verbose console output, display  */
+/*                          of SYZYGY DNA and Zmod calibration in enum  */
+/*      DPMUTIL_CFG_POWER   dpmutilFGetInfoPower/5V0/3V3/Vio            */
+/*      DPMUTIL_CFG_SET     dpmutilFSetPlatformConfig/VioConfig/        */
+/*                          FanConfig                                   */
+/*      DPMUTIL_CFG_RESET   dpmutilFResetPMCU                           */
+/*      DPMUTIL_CFG_ZMODCAL ZmodCal sample conversion kernels and       */
+/*                          FZmodADC/DAC/DigitizerCalGetKernel          */
+/*      DPMUTIL_CFG_RATE    a rate controller per slave, up to 12, and  */
+/*                          the turnaround level statistics; without it */
+/*                          one controller is shared by every slave and */
+/*                          starts over whenever the slave changes      */
+/*      DPMUTIL_CFG_USDT    static tracepoints for perf, bpftrace and   */
+/*                          other USDT consumers, enabled by default    */
+/*                          only when <sys/sdt.h> is available          */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef DPMUTILCFG_H_
+#define DPMUTILCFG_H_
+
+/* ------------------------------------------------------------ */
+/*                  Miscellaneous Declarations                  */
+/* ------------------------------------------------------------ */
+
+#if defined(DPMUTIL_MINIMAL)
+#if !defined(DPMUTIL_CFG_PRINT)
+#define DPMUTIL_CFG_PRINT	0
+#endif
+#if !defined(DPMUTIL_CFG_SET)
+#define DPMUTIL_CFG_SET		0
+#endif
+#if !defined(DPMUTIL_CFG_RESET)
+#define DPMUTIL_CFG_RESET	0
+#endif
+#if !defined(DPMUTIL_CFG_USDT)
+#define DPMUTIL_CFG_USDT	0
+#endif
+#if !defined(DPMUTIL_CFG_ZMODCAL)
+#define DPMUTIL_CFG_ZMODCAL	0
+#endif
+#if !defined(DPMUTIL_CFG_RATE)
+#define DPMUTIL_CFG_RATE	0
+#endif
+#endif
+
+#if !defined(DPMUTIL_CFG_PRINT)
+#define DPMUTIL_CFG_PRINT	1
+#endif
+#if !defined(DPMUTIL_CFG_POWER)
+#define DPMUTIL_CFG_POWER	1
+#endif
+#if !defined(DPMUTIL_CFG_SET)
+#define DPMUTIL_CFG_SET		1
+#endif
+#if !defined(DPMUTIL_CFG_RESET)
+#define DPMUTIL_CFG_RESET	1
+#endif
+#if !defined(DPMUTIL_CFG_ZMODCAL)
+#define DPMUTIL_CFG_ZMODCAL	1
+#endif
+#if !defined(DPMUTIL_CFG_RATE)
+#define DPMUTIL_CFG_RATE	1
+#endif
+#if !defined(DPMUTIL_CFG_USDT) && defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define DPMUTIL_CFG_USDT	1
+#endif
+#endif
+#if !defined(DPMUTIL_CFG_USDT)
+#define DPMUTIL_CFG_USDT	0
+#endif
+
+/* All console output of the library goes through the following
+** macros. DpmVerbose only prints when dpmutilfVerbose is set. When
+** output is disabled the arguments are still referenced, so variables
+** that only feed messages don't produce warnings, but they're never
+** evaluated and no reference to printf is emitted.
+*/
+#if DPMUTIL_CFG_PRINT
+#include <stdio.h>
+#define DpmPrintf(...)		printf(__VA_ARGS__)
+#define DpmVerbose(...)		do { if ( dpmutilfVerbose ) { printf(__VA_ARGS__); } } while ( 0 )
+#else
+static inline void DpmNoPrint(const char* szFmt, ...) { (void)szFmt; }
+#define DpmPrintf(...)		do { if ( 0 ) { DpmNoPrint(__VA_ARGS__); } } while ( 0 )
+#define DpmVerbose(...)		DpmPrintf(__VA_ARGS__)
+#endif
+
+/* Static tracepoints of the provider "dpmutil". An enabled probe is a
+** single nop plus an ELF note that perf or bpftrace patch at run time,
+** so probes stay in production builds. When USDT is disabled the
+** arguments are referenced but never evaluated, as for DpmPrintf.
+**
+** sys/sdt.h records the size and signedness of each argument from its
+** type, which for BYTE counts, expressions promoted to int and the
+** __func__ array would differ from one argument to the next. Every
+** argument is therefore passed as a long: numbers are read as integers
+** and the name passed to the api probes with str(). "make usdt-check"
+** lists the argument formats recorded in dpmutil.
+*/
+#if DPMUTIL_CFG_USDT
+#include <sys/sdt.h>
+#define DpmProbeArg(a)						((long)(a))
+#define DpmProbe1(name, a1)					DTRACE_PROBE1(dpmutil, name, DpmProbeArg(a1))
+#define DpmProbe2(name, a1, a2)				DTRACE_PROBE2(dpmutil, name, DpmProbeArg(a1), DpmProbeArg(a2))
+#define DpmProbe3(name, a1, a2, a3)			DTRACE_PROBE3(dpmutil, name, DpmProbeArg(a1), DpmProbeArg(a2), DpmProbeArg(a3))
+#define DpmProbe4(name, a1, a2, a3, a4)		DTRACE_PROBE4(dpmutil, name, DpmProbeArg(a1), DpmProbeArg(a2), DpmProbeArg(a3), DpmProbeArg(a4))
+#else
+#define DpmProbe1(name, a1)					do { if ( 0 ) { (void)(a1); } } while ( 0 )
+#define DpmProbe2(name, a1, a2)				do { if ( 0 ) { (void)(a1); (void)(a2); } } while ( 0 )
+#define DpmProbe3(name, a1, a2, a3)			do { if ( 0 ) { (void)(a1); (void)(a2); (void)(a3); } } while ( 0 )
+#define DpmProbe4(name, a1, a2, a3, a4)		do { if ( 0 ) { (void)(a1); (void)(a2); (void)(a3); (void)(a4); } } while ( 0 )
+#endif
+
+/* ------------------------------------------------------------ */
+
+#endif /* DPMUTILCFG_H_ */
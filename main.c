@@ -59,6 +59,8 @@
 #include <dirent.h>
 #include <inttypes.h>
 #include "dpmutil.h"
+#include "DpmFs.h"
+#include "DpmSoak.h"
 
 /* ------------------------------------------------------------ */
 /*                  Miscellaneous Declarations                  */
@@ -76,16 +78,6 @@
 #define SzFromMacroArg_(x)  #x
 #define SzFromMacroArg(x)   SzFromMacroArg_(x)
 
-/* The following addresses are utilized to retrieve information
-** from Digilent SYZYGY pods (ZMODs).
-*/
-#define addrPdid			0x80FC
-
-/* The following macro can be utilized to convert a Digilent PDID
-** into a product.
-*/
-#define ProductFromPdid(pdid)   ((pdid >> 20) & 0xFFF)
-
 /* ------------------------------------------------------------ */
 /*                  Local Type Definitions                      */
 /* ------------------------------------------------------------ */
@@ -128,6 +120,10 @@ BOOL	FSetPlatformConfig();
 BOOL	FSetVioConfig();
 BOOL	FSetFanConfig();
 BOOL	FResetPMCU();
+#if defined(DPMUTIL_FUSE)
+BOOL	FMount();
+#endif
+BOOL	FSoak();
 BOOL	FHelp();
 BOOL	FVersion();
 
@@ -155,6 +151,10 @@ CMD     rgcmd[] = {
 	{"setviocfg",    "set the VADJ_n_OVERRIDE reigster for a specific channel",    &FSetVioConfig },
 	{"setfancfg",    "set the FAN_n_CONFIGURATION register for the specified fan", &FSetFanConfig },
 	{"resetpmcu",    "reset the platform mcu",                                     &FResetPMCU },
+#if defined(DPMUTIL_FUSE)
+	{"mount",        "mount the board as a file tree, mount <directory>",          &FMount },
+#endif
+	{"soak",         "measure bus throughput, latency and error rates over time",  &FSoak },
     {"help",         "",                                                           &FHelp },
     {"version",      "",                                                           &FVersion },
     {"",             "",                                                           NULL }
@@ -173,6 +173,9 @@ OPTN   rgoptn[] = {
 	{"-checkcrc    ", "perform SYZYGY Header CRC check, checkrc <y/n>"},
 	{"-speed       ", "fan speed, speed <minimum,medium,maximum,auto>"},
 	{"-probe       ", "fan temperature probe, probe <none,p1,p2,p3,p4>"},
+	{"-duration    ", "soak duration, duration <seconds>"},
+	{"-mix         ", "soak read weights, mix <register>,<dna>,<calibration>"},
+	{"-floor       ", "minimum PMCU turnaround for soak, floor <microseconds>"},
     {"-?, --help   ", "print usage, supported arguments, and options"},
     {"-v, --version", "print program version"},
 //	{"--verbose    ", "display more detailed error messages"},
@@ -202,6 +205,7 @@ BOOL	fSetProbe;
 //BOOL	fMagic;
 
 char*	pszCmd;
+char*	pszMountDir;
 //char*	pszDNAFile;
 char	szCmd[cchCmdMax + 1];
 BYTE	chanidGetSet;
@@ -210,6 +214,7 @@ BYTE	portid;
 BYTE	fspeedSet;
 BYTE	fprobeSet;
 WORD	vltgSet;
+DPM_SOAK_CFG	soakcfg;
 dpmutildevInfo_t devInfo;
 dpmutilPowerInfo_t powerInfo[8];
 dpmutilPortInfo_t portInfo[8];
@@ -323,6 +328,14 @@ BOOL	FSetFanConfig(){
 BOOL	FResetPMCU(){
 	return dpmutilFResetPMCU();
 }
+#if defined(DPMUTIL_FUSE)
+BOOL	FMount(){
+	return DpmFsMount(pszCmd, pszMountDir);
+}
+#endif
+BOOL	FSoak(){
+	return DpmSoakRun(&soakcfg);
+}
 
 
 /* ------------------------------------------------------------ */
@@ -347,6 +360,7 @@ FParseArguments(int cszArg, char* rgszArg[]) {
 	DWORD	ccmd;
 
 	pszCmd = NULL;
+	pszMountDir = NULL;
 //	pszDNAFile = NULL;
 
 	/* Set the number of commands discovered thus far to 0. If the user
@@ -388,6 +402,12 @@ FParseArguments(int cszArg, char* rgszArg[]) {
 	fspeedSet = fancfgMinimumSpeed;
 	fprobeSet = fancfgTempProbeNone;
 	vltgSet = 0;
+	soakcfg.sDuration = sSoakDurationDefault;
+	soakcfg.wtReg = wtSoakRegDefault;
+	soakcfg.wtDna = wtSoakDnaDefault;
+	soakcfg.wtCal = wtSoakCalDefault;
+	soakcfg.fFloor = fFalse;
+	soakcfg.usFloor = 0;
 
 	/* Set all of the string parameters to their default values: empty
 	** strings.
@@ -812,6 +832,70 @@ FParseArguments(int cszArg, char* rgszArg[]) {
 			fSetVoltage = fTrue;
 		}
 
+		/* Check for the -duration option. If this option is specified
+		** then the user wants to change how long the soak test runs.
+		*/
+		else if ( 0 == strcmp(rgszArg[iszArg], "-duration") ) {
+			iszArg++;
+			if ( iszArg >= cszArg ) {
+				printf("ERROR: no duration specified\n");
+				printf("specify a value in seconds\n");
+				return fFalse;
+			}
+
+			if (( NULL == rgszArg[iszArg] ) ||
+				( 1 != sscanf(rgszArg[iszArg], "%u", &soakcfg.sDuration) ) ||
+				( 0 == soakcfg.sDuration )) {
+				printf("ERROR: invalid duration specified\n");
+				printf("specify a value in seconds\n");
+				return fFalse;
+			}
+		}
+
+		/* Check for the -mix option. If this option is specified then
+		** the user wants to change the relative weights of the register,
+		** DNA and calibration reads issued by the soak test.
+		*/
+		else if ( 0 == strcmp(rgszArg[iszArg], "-mix") ) {
+			iszArg++;
+			if ( iszArg >= cszArg ) {
+				printf("ERROR: no mix specified\n");
+				printf("specify three weights, e.g. \"4,1,1\"\n");
+				return fFalse;
+			}
+
+			if (( NULL == rgszArg[iszArg] ) ||
+				( 3 != sscanf(rgszArg[iszArg], "%u,%u,%u", &soakcfg.wtReg, &soakcfg.wtDna, &soakcfg.wtCal) ) ||
+				( 0 == (soakcfg.wtReg + soakcfg.wtDna + soakcfg.wtCal) ) ||
+				( 1000 < soakcfg.wtReg ) || ( 1000 < soakcfg.wtDna ) || ( 1000 < soakcfg.wtCal )) {
+				printf("ERROR: invalid mix specified\n");
+				printf("specify three weights between 0 and 1000, e.g. \"4,1,1\"\n");
+				return fFalse;
+			}
+		}
+
+		/* Check for the -floor option. If this option is specified then
+		** the user wants to let the soak test tighten the turnaround
+		** delay of the Platform MCU below its documented minimum.
+		*/
+		else if ( 0 == strcmp(rgszArg[iszArg], "-floor") ) {
+			iszArg++;
+			if ( iszArg >= cszArg ) {
+				printf("ERROR: no floor specified\n");
+				printf("specify a value in microseconds\n");
+				return fFalse;
+			}
+
+			if (( NULL == rgszArg[iszArg] ) ||
+				( 1 != sscanf(rgszArg[iszArg], "%u", &soakcfg.usFloor) )) {
+				printf("ERROR: invalid floor specified\n");
+				printf("specify a value in microseconds\n");
+				return fFalse;
+			}
+
+			soakcfg.fFloor = fTrue;
+		}
+
 //		else if ( 0 == strcmp(rgszArg[iszArg], "-magic") ) {
 //			iszArg++;
 //			if ( iszArg >= cszArg ) {
@@ -909,6 +993,17 @@ FParseArguments(int cszArg, char* rgszArg[]) {
 			strcpy(szCmd, rgszArg[iszArg]);
 			fCmd = fTrue;
 			ccmd++;
+
+#if defined(DPMUTIL_FUSE)
+			/* The mount command takes the mount point as its argument.
+			*/
+			if (( 0 == strcmp(szCmd, "mount") ) &&
+				( iszArg + 1 < cszArg ) &&
+				( '-' != rgszArg[iszArg + 1][0] )) {
+				iszArg++;
+				pszMountDir = rgszArg[iszArg];
+			}
+#endif
 		}
 
 		iszArg++;
@@ -116,7 +116,7 @@
 */
 BOOL
 SyzygyI2cRead(int fdI2cDev, BYTE addrI2cSlave, WORD addrRead, BYTE* pbRead, WORD cbRead, WORD* pcbRead) {
-	return I2CHALRead(fdI2cDev, addrI2cSlave, addrRead, pbRead, cbRead, pcbRead, 0);
+	return I2CHALRead(fdI2cDev, addrI2cSlave, addrRead, pbRead, cbRead, pcbRead, usSzgTurnaroundMin);
 }
 
 /* ------------------------------------------------------------ */
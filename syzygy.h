@@ -61,11 +61,28 @@
 #define addrFlashMagic		0x6999
 #define addrDnaStart		0x8000
 
+/* The following addresses are utilized to retrieve information
+** from Digilent SYZYGY pods (ZMODs).
+*/
+#define addrPdid			0x80FC
+
+/* The following macro can be utilized to convert a Digilent PDID
+** into a product.
+*/
+#define ProductFromPdid(pdid)   (((pdid) >> 20) & 0xFFF)
+
 /* Define the maximum number of bytes that can be stored in the
 ** SYZYGY DNA section of the pMCU flash.
 */
 #define cbSyzygyDnaMax		4096
 
+/* Define the minimum number of microseconds the pMCU firmware requires
+** between the memory address write and the data read. This is the
+** delay every read used before the HAL adapted it, so the rate
+** controller never goes below it.
+*/
+#define usSzgTurnaroundMin	50
+
 /* ------------------------------------------------------------ */
 /*                  General Type Declarations                   */
 /* ------------------------------------------------------------ */
@@ -0,0 +1,200 @@
+/************************************************************************/
+/*                                                                      */
+/*  BenchZmodCal.c - Zmod sample calibration kernel throughput          */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This program measures the throughput of every implementation of     */
+/*  ZmodCalPackedToVolts and ZmodCalVoltsToPacked that the processor    */
+/*  supports, on one channel of an interleaved Zmod stream and on a     */
+/*  single channel stream, for a buffer that fits in the cache and for  */
+/*  one that doesn't. It is built and run by "make bench".              */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stdtypes.h"
+#include "ZmodCal.h"
+#include "ZmodADC.h"
+#include "ZmodDAC.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+/* Define the buffer sizes in samples per channel and the number of
+** samples that are converted for each measurement.
+*/
+#define csmpSmall			(16 * 1024)
+#define csmpLarge			(16 * 1024 * 1024)
+#define csmpMeasure			(256 * 1024 * 1024)
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static const char*	rgszImpl[] = { "scalar", "SSE2/NEON", "AVX2" };
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static double	MsmpPerSec(const ZMOD_CAL_KERNEL* pkern, INT16* rgw, DWORD cwStride, float* rgvlt, DWORD csmp, BOOL fCodes);
+static void		FillInput(INT16* rgw, DWORD cwStride, float* rgvlt, DWORD csmp, BOOL fCodes);
+static double	SecNow();
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+int
+main() {
+
+	ZMOD_ADC_CAL	adcal;
+	ZMOD_DAC_CAL	dacal;
+	ZMOD_CAL_KERNEL	kernAdc;
+	ZMOD_CAL_KERNEL	kernDac;
+	INT16*			rgw;
+	float*			rgvlt;
+	DWORD			cwStride;
+	BYTE			impl;
+
+	rgw = (INT16*)malloc(csmpLarge * cwZmodStride * sizeof(INT16));
+	rgvlt = (float*)malloc(csmpLarge * sizeof(float));
+	if (( NULL == rgw ) || ( NULL == rgvlt )) {
+		printf("Error: failed to allocate the sample buffers\n");
+		return 1;
+	}
+
+	/* Typical ZmodADC low gain and ZmodDAC high gain kernels.
+	*/
+	memset(&adcal, 0, sizeof(adcal));
+	memset(&dacal, 0, sizeof(dacal));
+	adcal.cal[0][0][0] = 0.0213f;
+	adcal.cal[0][0][1] = -0.0104f;
+	dacal.cal[0][1][0] = -0.0187f;
+	dacal.cal[0][1][1] = 0.0071f;
+	FZmodADCCalGetKernel(adcal, 0, fFalse, &kernAdc);
+	FZmodDACCalGetKernel(dacal, 0, fTrue, &kernDac);
+
+	/* Convert one channel of an interleaved Zmod stream, then a stream
+	** that holds a single channel.
+	*/
+	printf("%-10s %-12s %-7s %14s %14s\n", "impl", "conversion", "stride", "MS/s (cache)", "MS/s (memory)");
+
+	for ( impl = zmodcalimplScalar; impl <= zmodcalimplAvx2; impl++ ) {
+		if ( ZmodCalSetImpl(impl) != impl ) {
+			printf("%-10s not supported\n", rgszImpl[impl]);
+			continue;
+		}
+
+		for ( cwStride = cwZmodStride; cwStride >= 1; cwStride-- ) {
+			printf("%-10s %-12s %-7u %14.1f %14.1f\n", rgszImpl[impl], "codes>volts", cwStride,
+				MsmpPerSec(&kernAdc, rgw, cwStride, rgvlt, csmpSmall, fTrue),
+				MsmpPerSec(&kernAdc, rgw, cwStride, rgvlt, csmpLarge, fTrue));
+			printf("%-10s %-12s %-7u %14.1f %14.1f\n", rgszImpl[impl], "volts>codes", cwStride,
+				MsmpPerSec(&kernDac, rgw, cwStride, rgvlt, csmpSmall, fFalse),
+				MsmpPerSec(&kernDac, rgw, cwStride, rgvlt, csmpLarge, fFalse));
+		}
+	}
+
+	ZmodCalSetImpl(zmodcalimplAvx2);
+	free(rgw);
+	free(rgvlt);
+
+	return 0;
+}
+
+/* ------------------------------------------------------------ */
+/***    MsmpPerSec
+**
+**  Description:
+**      Converts csmpMeasure samples in passes over a buffer of csmp
+**      samples of one channel, with the code left justified in its
+**      word, and returns the throughput in millions of samples per
+**      second. The input is restored before each pass, outside of the
+**      measured time.
+*/
+static double
+MsmpPerSec(const ZMOD_CAL_KERNEL* pkern, INT16* rgw, DWORD cwStride, float* rgvlt, DWORD csmp, BOOL fCodes) {
+
+	DWORD	ipass;
+	DWORD	cpass;
+	double	secTotal;
+	double	secStart;
+
+	cpass = csmpMeasure / csmp;
+	secTotal = 0;
+
+	for ( ipass = 0; ipass < cpass; ipass++ ) {
+		FillInput(rgw, cwStride, rgvlt, csmp, fCodes);
+		secStart = SecNow();
+		if ( fCodes ) {
+			ZmodCalPackedToVolts(pkern, rgw, cwStride, cbitZmodShift, rgvlt, csmp);
+		}
+		else {
+			ZmodCalVoltsToPacked(pkern, rgvlt, rgw, cwStride, cbitZmodShift, csmp);
+		}
+		secTotal += SecNow() - secStart;
+	}
+
+	return ((double)cpass * csmp) / secTotal / 1.0e6;
+}
+
+/* ------------------------------------------------------------ */
+/***    FillInput
+**
+**  Description:
+**      Fills the words of a stream with codes spanning the full range,
+**      or a buffer with voltages spanning the full range.
+*/
+static void
+FillInput(INT16* rgw, DWORD cwStride, float* rgvlt, DWORD csmp, BOOL fCodes) {
+
+	DWORD	ismp;
+
+	for ( ismp = 0; ismp < csmp; ismp++ ) {
+		if ( fCodes ) {
+			rgw[ismp * cwStride] = (INT16)(((INT32)(ismp % (2 * ccodeZmodHalf)) - ccodeZmodHalf) * (1 << cbitZmodShift));
+		}
+		else {
+			rgvlt[ismp] = -5.0f + (float)(ismp % 1000) / 100.0f;
+		}
+	}
+}
+
+/* ------------------------------------------------------------ */
+/***    SecNow
+**
+**  Description:
+**      Returns the time of the monotonic clock in seconds.
+*/
+static double
+SecNow() {
+
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1.0e9;
+}
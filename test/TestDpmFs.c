@@ -0,0 +1,405 @@
+/************************************************************************/
+/*                                                                      */
+/*  TestDpmFs.c - DpmFs filesystem operation tests                      */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This program calls the FUSE operations of DpmFs directly, without   */
+/*  mounting the filesystem, against the simulated I2C bus. It checks   */
+/*  the attributes and listing of the tree, the contents of register,   */
+/*  DNA and calibration files, writes to configuration files, that a    */
+/*  pod whose contents couldn't be read is read again on the next       */
+/*  access, and that the calibration files follow the kind of pod.      */
+/*                                                                      */
+/*  DpmFs.c is included so that its static operations and state can be */
+/*  reached. It's built with DPMUTIL_FUSE and I2CHAL_SIM defined.       */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#include "DpmFs.c"
+#include "I2CSim.h"
+#include "TestUtil.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+#define cchFileMax			256
+#define cchListMax			1024
+#define cFaultPod			1000
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static char		szList[cchListMax];
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static void		TestGetattr();
+static void		TestReaddir();
+static void		TestOpen();
+static void		TestReadRegisters();
+static void		TestPodRetry();
+static void		TestReadPods();
+static void		TestWrite();
+static void		TestSwapPod();
+static void		SwapPodB(DWORD pdid, ZMOD_DIGITIZER_CAL* pdgcal);
+static int		ErrReadFile(const char* szPath, char* pch, size_t cch, off_t off);
+static int		ErrWriteFile(const char* szPath, const char* szVal);
+static BOOL		FReadIs(const char* szPath, const char* szExpected);
+static int		FillList(void* pvBuf, const char* szName, const struct stat* pst, off_t off, enum fuse_fill_dir_flags flags);
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+int
+main() {
+
+	if ( ! DpmSessionOpen(&sessFs) ) {
+		printf("FAIL: DpmSessionOpen\n");
+		return 1;
+	}
+	if ( ! FBuildTree() ) {
+		printf("FAIL: FBuildTree\n");
+		return 1;
+	}
+	dpmutilfVerbose = fFalse;
+
+	TestGetattr();
+	TestReaddir();
+	TestOpen();
+	TestReadRegisters();
+	TestPodRetry();
+	TestReadPods();
+	TestWrite();
+	TestSwapPod();
+
+	DpmSessionClose(&sessFs);
+
+	return TestResult("TestDpmFs");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestGetattr
+*/
+static void
+TestGetattr() {
+
+	struct stat	st;
+
+	TestCheck(0 == opsDpmFs.getattr("/", &st, NULL), "getattr /");
+	TestCheck(S_ISDIR(st.st_mode), "/ is a directory");
+	TestCheck(0 == opsDpmFs.getattr("/pdid", &st, NULL), "getattr /pdid");
+	TestCheck(S_ISREG(st.st_mode) && ( 0444 == (st.st_mode & 0777) ), "/pdid is a read-only file");
+	TestCheck(0 == opsDpmFs.getattr("/vadj/A/enable", &st, NULL), "getattr /vadj/A/enable");
+	TestCheck(0644 == (st.st_mode & 0777), "/vadj/A/enable is writable");
+	TestCheck(0 == opsDpmFs.getattr("/port/A/cal/factory.bin", &st, NULL), "getattr /port/A/cal/factory.bin");
+	TestCheck(sizeof(ZMOD_ADC_CAL) == st.st_size, "calibration files have the size of a record");
+	TestCheck(-ENOENT == opsDpmFs.getattr("/vadj/Z", &st, NULL), "getattr of a missing node fails");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestReaddir
+*/
+static void
+TestReaddir() {
+
+	szList[0] = '\0';
+	TestCheck(0 == opsDpmFs.readdir("/", szList, FillList, 0, NULL, 0), "readdir /");
+	TestCheck(NULL != strstr(szList, " pdid "), "/ lists pdid");
+	TestCheck(NULL != strstr(szList, " vadj "), "/ lists vadj");
+	TestCheck(NULL != strstr(szList, " port "), "/ lists port");
+	TestCheck(NULL == strstr(szList, " A "), "/ doesn't list grandchildren");
+
+	szList[0] = '\0';
+	TestCheck(0 == opsDpmFs.readdir("/port", szList, FillList, 0, NULL, 0), "readdir /port");
+	TestCheck(0 == strcmp(szList, " . .. A B "), "/port lists both simulated ports");
+
+	TestCheck(-ENOTDIR == opsDpmFs.readdir("/pdid", szList, FillList, 0, NULL, 0), "readdir of a file fails");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestOpen
+*/
+static void
+TestOpen() {
+
+	struct fuse_file_info	fi;
+
+	memset(&fi, 0, sizeof(fi));
+	fi.flags = O_RDONLY;
+	TestCheck(0 == opsDpmFs.open("/pdid", &fi), "open /pdid for reading");
+	TestCheck(fi.direct_io, "files are opened with direct I/O");
+
+	fi.flags = O_WRONLY;
+	TestCheck(-EACCES == opsDpmFs.open("/pdid", &fi), "open /pdid for writing fails");
+	TestCheck(0 == opsDpmFs.open("/fan/1/speed", &fi), "open /fan/1/speed for writing");
+	TestCheck(-EISDIR == opsDpmFs.open("/vadj", &fi), "open of a directory fails");
+	TestCheck(-EACCES == opsDpmFs.truncate("/pdid", 0, NULL), "truncate of a read-only file fails");
+	TestCheck(0 == opsDpmFs.truncate("/fan/1/speed", 0, NULL), "truncate of a writable file");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestReadRegisters
+*/
+static void
+TestReadRegisters() {
+
+	char	rgch[cchFileMax];
+
+	TestCheck(FReadIs("/pdid", "0x00000001\n"), "read /pdid");
+	TestCheck(FReadIs("/vadj/A/voltage", "1800\n"), "read /vadj/A/voltage");
+	TestCheck(FReadIs("/fan/1/speed", "auto\n"), "read /fan/1/speed");
+	TestCheck(FReadIs("/port/B/i2c_address", "0x31\n"), "read /port/B/i2c_address");
+
+	TestCheck(3 == ErrReadFile("/pdid", rgch, sizeof(rgch), 8), "read from an offset");
+	TestCheck(0 == memcmp(rgch, "01\n", 3), "read from an offset returns the tail");
+	TestCheck(0 == ErrReadFile("/pdid", rgch, sizeof(rgch), 64), "read past the end returns nothing");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestPodRetry
+**
+**  Description:
+**      The ZmodDAC stops responding before its contents are first read.
+**      Reads of its files must fail, and succeed once it responds again.
+*/
+static void
+TestPodRetry() {
+
+	I2CSimSetFault(addrSimPodB, ENXIO, cFaultPod);
+	TestCheck(0 > ErrReadFile("/port/B/dna/product", szList, cchFileMax, 0), "read of a pod that doesn't respond fails");
+	TestCheck(! rgpod[1].fValid, "contents that couldn't be read aren't kept");
+
+	I2CSimSetFault(addrSimPodB, 0, 0);
+	I2CHALResetRate(addrSimPodB);
+	TestCheck(FReadIs("/port/B/dna/product", "Zmod DAC 1411-125\n"), "the pod is read again on the next access");
+	TestCheck(rgpod[1].fValid, "contents are kept once every read succeeded");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestReadPods
+*/
+static void
+TestReadPods() {
+
+	char			szPdid[16];
+	ZMOD_ADC_CAL	adcal;
+	ZMOD_DAC_CAL	dacal;
+
+	snprintf(szPdid, sizeof(szPdid), "0x%08X\n", (prodZmodADC << 20) | 1);
+	TestCheck(FReadIs("/port/A/pdid", szPdid), "read /port/A/pdid");
+	snprintf(szPdid, sizeof(szPdid), "0x%08X\n", (prodZmodDAC << 20) | 1);
+	TestCheck(FReadIs("/port/B/pdid", szPdid), "read /port/B/pdid");
+	TestCheck(FReadIs("/port/A/dna/manufacturer", "Digilent\n"), "read /port/A/dna/manufacturer");
+	TestCheck(FReadIs("/port/A/dna/serial", "SIM000001\n"), "read /port/A/dna/serial");
+
+	TestCheck(sizeof(adcal) == ErrReadFile("/port/A/cal/factory.bin", (char*)&adcal, sizeof(adcal), 0), "read the ZmodADC factory calibration");
+	TestCheck(( 0xAD == adcal.id ) && ( 0.0125f == adcal.cal[0][0][0] ), "the ZmodADC factory calibration is correct");
+	TestCheck(sizeof(dacal) == ErrReadFile("/port/B/cal/user.bin", (char*)&dacal, sizeof(dacal), 0), "read the ZmodDAC user calibration");
+	TestCheck(( 0xAD == dacal.id ) && ( -0.0008f == dacal.cal[1][1][1] ), "the ZmodDAC user calibration is correct");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestWrite
+*/
+static void
+TestWrite() {
+
+	TestCheck(0 == ErrWriteFile("/vadj/A/override_voltage", "3300\n"), "write /vadj/A/override_voltage");
+	TestCheck(0 == ErrWriteFile("/vadj/A/override", "1\n"), "write /vadj/A/override");
+	TestCheck(FReadIs("/vadj/A/override", "1\n"), "the override is read back");
+	TestCheck(FReadIs("/vadj/A/voltage", "3300\n"), "the overridden voltage is read back");
+	TestCheck(0 == ErrWriteFile("/vadj/A/override", "0\n"), "clear /vadj/A/override");
+	TestCheck(FReadIs("/vadj/A/voltage", "1800\n"), "the default voltage is read back");
+
+	TestCheck(0 == ErrWriteFile("/fan/1/speed", "maximum\n"), "write /fan/1/speed");
+	TestCheck(FReadIs("/fan/1/speed", "maximum\n"), "the fan speed is read back");
+	TestCheck(0 == ErrWriteFile("/fan/1/speed", "auto"), "restore /fan/1/speed");
+
+	TestCheck(-EINVAL == ErrWriteFile("/fan/1/speed", "fast\n"), "an invalid fan speed is rejected");
+	TestCheck(-EINVAL == ErrWriteFile("/vadj/A/enable", "maybe\n"), "an invalid boolean is rejected");
+	TestCheck(-EACCES == ErrWriteFile("/vadj/A/voltage", "1200\n"), "a read-only file can't be written");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestSwapPod
+**
+**  Description:
+**      The ZmodDAC is replaced by a pod of unknown kind, which has no
+**      calibration files, and then by a ZmodDigitizer, whose files must
+**      hold its own calibration records. The simulated DAC isn't
+**      restored, so this runs last.
+*/
+static void
+TestSwapPod() {
+
+	struct stat			st;
+	ZMOD_DIGITIZER_CAL	dgcal;
+	ZMOD_DIGITIZER_CAL	dgcalRead;
+	BYTE				ihz;
+
+	memset(&dgcal, 0, sizeof(dgcal));
+	dgcal.id = 0xDD;
+	dgcal.date = 1577836800;
+	for ( ihz = 0; ihz < cbDigitizerCalibHzSteps; ihz++ ) {
+		dgcal.hz[ihz] = ihz;
+		dgcal.cal[ihz][0][0] = 0.001f * ihz;
+		dgcal.cal[ihz][1][1] = -0.002f * ihz;
+	}
+
+	SwapPodB((0x7FF << 20) | 1, NULL);
+	TestCheck(0 == opsDpmFs.getattr("/port/B/cal/factory.bin", &st, NULL), "getattr the calibration of an unknown pod");
+	TestCheck(0 == st.st_size, "a pod of unknown kind has empty calibration files");
+	TestCheck(-EIO == ErrReadFile("/port/B/cal/factory.bin", (char*)&dgcalRead, sizeof(dgcalRead), 0), "a pod of unknown kind has no calibration");
+
+	SwapPodB((prodZmodDigitizer << 20) | 1, &dgcal);
+	TestCheck(0 == opsDpmFs.getattr("/port/B/cal/user.bin", &st, NULL), "getattr the ZmodDigitizer user calibration");
+	TestCheck(sizeof(ZMOD_DIGITIZER_CAL) == st.st_size, "the calibration files have the size of a ZmodDigitizer record");
+	memset(&dgcalRead, 0, sizeof(dgcalRead));
+	TestCheck(sizeof(dgcalRead) == ErrReadFile("/port/B/cal/factory.bin", (char*)&dgcalRead, sizeof(dgcalRead), 0), "read the ZmodDigitizer factory calibration");
+	TestCheck(0 == memcmp(&dgcal, &dgcalRead, sizeof(dgcal)), "the ZmodDigitizer factory calibration is correct");
+	memset(&dgcalRead, 0, sizeof(dgcalRead));
+	TestCheck(sizeof(dgcalRead) == ErrReadFile("/port/B/cal/user.bin", (char*)&dgcalRead, sizeof(dgcalRead), 0), "read the ZmodDigitizer user calibration");
+	TestCheck(0 == memcmp(&dgcal, &dgcalRead, sizeof(dgcal)), "the ZmodDigitizer user calibration is correct");
+}
+
+/* ------------------------------------------------------------ */
+/***    SwapPodB
+**
+**  Description:
+**      Unplugs the pod on port B, gives it a new PDID and, unless
+**      pdgcal is NULL, ZmodDigitizer calibration records, and plugs it
+**      back in.
+*/
+static void
+SwapPodB(DWORD pdid, ZMOD_DIGITIZER_CAL* pdgcal) {
+
+	struct stat	st;
+	BYTE		fsStatus;
+	BYTE		fsAbsent;
+
+	DpmSessionPmcuRead(&sessFs, regaddrPortBStatus, &fsStatus, 1, NULL);
+	fsAbsent = 0;
+	DpmSessionPmcuWrite(&sessFs, regaddrPortBStatus, &fsAbsent, 1, NULL);
+	opsDpmFs.getattr("/port/B/cal/factory.bin", &st, NULL);
+
+	DpmSessionSyzygyWrite(&sessFs, addrSimPodB, addrPdid, (BYTE*)&pdid, 4, NULL);
+	if ( NULL != pdgcal ) {
+		DpmSessionSyzygyWrite(&sessFs, addrSimPodB, addrDigitizerFactCalStart, (BYTE*)pdgcal, sizeof(ZMOD_DIGITIZER_CAL), NULL);
+		DpmSessionSyzygyWrite(&sessFs, addrSimPodB, addrDigitizerUserCalStart, (BYTE*)pdgcal, sizeof(ZMOD_DIGITIZER_CAL), NULL);
+	}
+
+	DpmSessionPmcuWrite(&sessFs, regaddrPortBStatus, &fsStatus, 1, NULL);
+}
+
+/* ------------------------------------------------------------ */
+/***    ErrReadFile
+**
+**  Description:
+**      Reads a file through the read operation. Returns the number of
+**      bytes read or a negative errno.
+*/
+static int
+ErrReadFile(const char* szPath, char* pch, size_t cch, off_t off) {
+
+	struct fuse_file_info	fi;
+
+	memset(&fi, 0, sizeof(fi));
+	fi.flags = O_RDONLY;
+
+	return opsDpmFs.read(szPath, pch, cch, off, &fi);
+}
+
+/* ------------------------------------------------------------ */
+/***    ErrWriteFile
+**
+**  Description:
+**      Writes a value to a file the way "echo value > file" does.
+**      Returns 0 or a negative errno.
+*/
+static int
+ErrWriteFile(const char* szPath, const char* szVal) {
+
+	struct fuse_file_info	fi;
+	int						err;
+
+	memset(&fi, 0, sizeof(fi));
+	fi.flags = O_WRONLY;
+
+	err = opsDpmFs.truncate(szPath, 0, &fi);
+	if ( 0 != err ) {
+		return err;
+	}
+
+	err = opsDpmFs.write(szPath, szVal, strlen(szVal), 0, &fi);
+	if ( 0 > err ) {
+		return err;
+	}
+
+	return ( (size_t)err == strlen(szVal) ) ? 0 : -EIO;
+}
+
+/* ------------------------------------------------------------ */
+/***    FReadIs
+**
+**  Description:
+**      Returns fTrue if the contents of a file are szExpected.
+*/
+static BOOL
+FReadIs(const char* szPath, const char* szExpected) {
+
+	char	rgch[cchFileMax];
+	int		cch;
+
+	cch = ErrReadFile(szPath, rgch, sizeof(rgch) - 1, 0);
+	if ( 0 > cch ) {
+		return fFalse;
+	}
+	rgch[cch] = '\0';
+
+	return ( 0 == strcmp(rgch, szExpected) ) ? fTrue : fFalse;
+}
+
+/* ------------------------------------------------------------ */
+/***    FillList
+**
+**  Description:
+**      Directory filler that appends each name to szList, surrounded
+**      by spaces.
+*/
+static int
+FillList(void* pvBuf, const char* szName, const struct stat* pst, off_t off, enum fuse_fill_dir_flags flags) {
+
+	char*	szBuf;
+	size_t	cch;
+
+	(void)pst;
+	(void)off;
+	(void)flags;
+
+	szBuf = (char*)pvBuf;
+	cch = strlen(szBuf);
+	if ( 0 == cch ) {
+		szBuf[cch++] = ' ';
+	}
+	snprintf(&szBuf[cch], cchListMax - cch, "%s ", szName);
+
+	return 0;
+}
@@ -0,0 +1,501 @@
+/************************************************************************/
+/*                                                                      */
+/*  TestI2CHAL.c - I2C HAL rate controller and retry policy tests       */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This program checks that the rate controller of the I2C HAL widens  */
+/*  the turnaround delay of a slave that NACKs reads and the gap of a   */
+/*  slave that's busy after writes, that both relax again after clean   */
+/*  transactions, and that the retry and failure counters match the     */
+/*  NACKs the simulated devices report, and that the turnaround of      */
+/*  every transaction of a long read is measured. It also checks that   */
+/*  writes are only retried after an address NACK and that the software */
+/*  reset register of the Platform MCU is never written twice.          */
+/*                                                                      */
+/*  It must be built with I2CHAL_SIM defined.                           */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include "stdtypes.h"
+#include "I2CHAL.h"
+#include "I2CSim.h"
+#include "PlatformMCU.h"
+#include "syzygy.h"
+#include "TestUtil.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+/* Define the simulated pod used by the tests, a scratch address in its
+** memory that nothing else reads, and the delays the simulated devices
+** are given.
+*/
+#define addrTestPod			0x30
+#define addrTestScratch		0x9000
+#define usTurnaroundTest	1000
+#define usBusyTest			5000
+
+/* Define the number of clean transactions after which the gap and the
+** turnaround are expected to have relaxed.
+*/
+#define ctxRelax			400
+
+/* Define a range of addresses where no device responds, larger than
+** the number of slaves the HAL keeps rate controllers for.
+*/
+#define addrEvictFirst		0x40
+#define caddrEvict			32
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static int	fdI2cTest;
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static void		TestTurnaround();
+static void		TestGap();
+static void		TestHeld();
+static void		TestWriteRetry();
+static void		TestReadRetry();
+static void		TestResetNoRetry();
+static void		TestPodFloor();
+static void		TestEvict();
+static BOOL		FWriteScratch(BYTE b);
+static BOOL		FReadScratch(BYTE* pb);
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+int
+main() {
+
+	fdI2cTest = I2CHALOpenI2cController();
+	if ( 0 > fdI2cTest ) {
+		printf("FAIL: I2CHALOpenI2cController\n");
+		return 1;
+	}
+
+	TestTurnaround();
+	TestGap();
+	TestHeld();
+	TestWriteRetry();
+	TestReadRetry();
+	TestResetNoRetry();
+	TestPodFloor();
+	TestEvict();
+
+	close(fdI2cTest);
+
+	return TestResult("TestI2CHAL");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestTurnaround
+**
+**  Description:
+**      The pod requires a turnaround delay far longer than the initial
+**      one. The first read must succeed after its NACKs widen the delay,
+**      every NACK must be counted as a retry, and after many clean reads
+**      the delay must have tightened without the reads failing. Every
+**      NACKed read must be counted as failed at the level of its
+**      interval, and the clean turnaround must lie above all of them.
+*/
+static void
+TestTurnaround() {
+
+	I2CHAL_RATE_STATS	stats0;
+	I2CHAL_RATE_STATS	stats1;
+	UINT32				cNackSim;
+	UINT32				cHeldClean;
+	UINT32				cHeldFail;
+	BOOL				fFailAbove;
+	BOOL				fHeldAt;
+	DWORD				itx;
+	DWORD				cok;
+	BYTE				ilevel;
+	BYTE				b;
+
+	I2CHALResetRate(addrTestPod);
+	I2CSimSetTiming(addrTestPod, usTurnaroundTest, 0);
+	cNackSim = I2CSimGetNackCount(addrTestPod);
+
+	TestCheck(FReadScratch(&b), "read with a long turnaround");
+	TestCheck(I2CHALGetRateStats(addrTestPod, &stats0), "get the rate statistics");
+	TestCheck(0 < stats0.cNack, "reads with a short turnaround are NACKed");
+	TestCheck(stats0.cNack == I2CSimGetNackCount(addrTestPod) - cNackSim, "every NACK of the device is counted");
+	TestCheck(stats0.cRetry == stats0.cNack, "every NACK is retried");
+	TestCheck(0 == stats0.cFail, "the read doesn't fail");
+	TestCheck(usTurnaroundTest <= stats0.usTurnaround, "the turnaround widens to what the device requires");
+
+	cok = 0;
+	for ( itx = 0; itx < ctxRelax; itx++ ) {
+		if ( FReadScratch(&b) ) {
+			cok++;
+		}
+	}
+	I2CHALGetRateStats(addrTestPod, &stats1);
+
+	TestCheck(ctxRelax == cok, "every read succeeds while the turnaround adapts");
+	TestCheck(stats1.usTurnaround < stats0.usTurnaround, "the turnaround tightens after clean reads");
+	TestCheck(stats1.cRetry == stats1.cNack, "every later NACK is retried");
+	TestCheck(0 == stats1.cFail, "no read fails");
+
+	cHeldClean = 0;
+	cHeldFail = 0;
+	fFailAbove = fFalse;
+	fHeldAt = fFalse;
+	for ( ilevel = 0; ilevel < clevelHeld; ilevel++ ) {
+		cHeldClean += stats1.rgcHeldClean[ilevel];
+		cHeldFail += stats1.rgcHeldFail[ilevel];
+		if (( 0 < stats1.rgcHeldFail[ilevel] ) && ( stats1.usHeldClean <= I2CHALHeldLevel(ilevel) )) {
+			fFailAbove = fTrue;
+		}
+		if (( stats1.usHeldClean == I2CHALHeldLevel(ilevel) ) && ( 0 < stats1.rgcHeldClean[ilevel] )) {
+			fHeldAt = fTrue;
+		}
+	}
+	TestCheck(cHeldClean == stats1.cHeld, "every clean read is counted at a level");
+	TestCheck(cHeldFail == stats1.cNack, "every NACKed read is counted as failed at a level");
+	TestCheck(usHeldNone != stats1.usHeldClean, "a clean turnaround is found");
+	TestCheck(! fFailAbove, "no read failed at or above the clean turnaround");
+	TestCheck(fHeldAt, "a read held at the clean turnaround");
+	TestCheck(usTurnaroundTest < stats1.usHeldClean + usHeldCoarse, "the clean turnaround includes the required delay");
+
+	/* A floor at the required delay prevents any further NACK.
+	*/
+	I2CHALSetTurnaroundFloor(addrTestPod, usTurnaroundTest);
+	I2CHALGetRateStats(addrTestPod, &stats0);
+	for ( itx = 0; itx < ctxRelax / 4; itx++ ) {
+		FReadScratch(&b);
+	}
+	I2CHALGetRateStats(addrTestPod, &stats1);
+	TestCheck(stats1.cNack == stats0.cNack, "reads above the turnaround floor aren't NACKed");
+	TestCheck(usTurnaroundTest <= stats1.usTurnaround, "the turnaround doesn't tighten below the floor");
+
+	I2CSimSetTiming(addrTestPod, 0, 0);
+	I2CHALResetRate(addrTestPod);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestGap
+**
+**  Description:
+**      The pod is busy for a while after every write. A second write
+**      right after the first must be retried until the pod is ready,
+**      widening the gap, and clean transactions must close the gap.
+*/
+static void
+TestGap() {
+
+	I2CHAL_RATE_STATS	stats0;
+	I2CHAL_RATE_STATS	stats1;
+	UINT32				cNackSim;
+	DWORD				itx;
+	BYTE				b;
+
+	I2CHALResetRate(addrTestPod);
+	I2CSimSetTiming(addrTestPod, 0, usBusyTest);
+	cNackSim = I2CSimGetNackCount(addrTestPod);
+
+	TestCheck(FWriteScratch(0x5A), "first write");
+	TestCheck(FWriteScratch(0xA5), "write while the device is busy");
+	TestCheck(I2CHALGetRateStats(addrTestPod, &stats0), "get the rate statistics");
+	TestCheck(0 < stats0.cNack, "the write to a busy device is NACKed");
+	TestCheck(stats0.cNack == I2CSimGetNackCount(addrTestPod) - cNackSim, "every NACK of the device is counted");
+	TestCheck(stats0.cRetry == stats0.cNack, "every NACK is retried");
+	TestCheck(0 == stats0.cFail, "the write doesn't fail");
+	TestCheck(0 < stats0.usGap, "the gap widens");
+
+	/* Let the busy period of the last write end before the reads.
+	*/
+	I2CSimSetTiming(addrTestPod, 0, 0);
+	usleep(usBusyTest);
+	for ( itx = 0; itx < ctxRelax; itx++ ) {
+		FReadScratch(&b);
+	}
+	I2CHALGetRateStats(addrTestPod, &stats1);
+
+	TestCheck(0xA5 == b, "the retried write reaches the device");
+	TestCheck(0 == stats1.usGap, "the gap closes after clean transactions");
+	TestCheck(stats1.cNack == stats0.cNack, "reads of a device that's ready aren't NACKed");
+
+	I2CHALResetRate(addrTestPod);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestHeld
+**
+**  Description:
+**      A read of 64 bytes takes two transactions. The interval measured
+**      for each must be recorded, and with a turnaround floor in place
+**      neither can be shorter than the floor.
+*/
+static void
+TestHeld() {
+
+	I2CHAL_RATE_STATS	stats0;
+	I2CHAL_RATE_STATS	stats1;
+	BYTE				rgb[64];
+
+	I2CHALResetRate(addrTestPod);
+	I2CHALSetTurnaroundFloor(addrTestPod, usTurnaroundTest);
+	I2CHALGetRateStats(addrTestPod, &stats0);
+
+	TestCheck(I2CHALRead(fdI2cTest, addrTestPod, addrTestScratch, rgb, sizeof(rgb), NULL, 0), "read 64 bytes");
+	I2CHALGetRateStats(addrTestPod, &stats1);
+
+	TestCheck(0 == stats0.cHeld, "no interval is measured before the first read");
+	TestCheck(2 == stats1.cHeld, "the interval of each transaction is measured");
+	TestCheck(usTurnaroundTest <= stats1.usHeldLast, "the measured interval includes the requested delay");
+	TestCheck(stats1.usHeldClean <= stats1.usHeldLast, "the clean turnaround is no longer than a clean read");
+	TestCheck(usTurnaroundTest < stats1.usHeldClean + usHeldCoarse, "the clean turnaround is the level of the floor or above");
+
+	I2CHALResetRate(addrTestPod);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestWriteRetry
+**
+**  Description:
+**      A write NACKed on its address is retried, while a write that
+**      failed with EIO, EREMOTEIO, EAGAIN or a timeout may have been
+**      partly applied and must fail at once.
+*/
+static void
+TestWriteRetry() {
+
+	static const int	rgerr[] = { EIO, EREMOTEIO, EAGAIN, ETIMEDOUT };
+	I2CHAL_RATE_STATS	stats0;
+	I2CHAL_RATE_STATS	stats1;
+	DWORD				ierr;
+	BOOL				fRet;
+	BYTE				b;
+	char				szCheck[64];
+
+	I2CHALResetRate(addrTestPod);
+	FWriteScratch(0x11);
+
+	I2CHALGetRateStats(addrTestPod, &stats0);
+	I2CSimSetFault(addrTestPod, ENXIO, 2);
+	TestCheck(FWriteScratch(0x22), "write after two address NACKs");
+	I2CHALGetRateStats(addrTestPod, &stats1);
+	TestCheck(2 == stats1.cRetry - stats0.cRetry, "an address NACK is retried");
+	TestCheck(stats1.cFail == stats0.cFail, "the retried write doesn't fail");
+
+	for ( ierr = 0; ierr < sizeof(rgerr) / sizeof(rgerr[0]); ierr++ ) {
+		I2CHALGetRateStats(addrTestPod, &stats0);
+		I2CSimSetFault(addrTestPod, rgerr[ierr], 1);
+		fRet = FWriteScratch(0x33);
+		I2CHALGetRateStats(addrTestPod, &stats1);
+
+		snprintf(szCheck, sizeof(szCheck), "a write failing with errno %d fails", rgerr[ierr]);
+		TestCheck(! fRet, szCheck);
+		snprintf(szCheck, sizeof(szCheck), "a write failing with errno %d isn't retried", rgerr[ierr]);
+		TestCheck(stats1.cRetry == stats0.cRetry, szCheck);
+		TestCheck(1 == stats1.cTx - stats0.cTx, "the failed write is attempted once");
+		TestCheck(1 == stats1.cFail - stats0.cFail, "the failed write is counted");
+		TestCheck(( ETIMEDOUT == rgerr[ierr] ) == ( 1 == stats1.cTimeout - stats0.cTimeout ),
+			"only the timeout is counted as a timeout");
+
+		TestCheck(FReadScratch(&b) && ( 0x22 == b ), "the failed write doesn't reach the device");
+	}
+
+	I2CHALResetRate(addrTestPod);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestReadRetry
+**
+**  Description:
+**      Reads don't change the device, so they're retried after any
+**      NACK, including a NACK reported as EIO.
+*/
+static void
+TestReadRetry() {
+
+	I2CHAL_RATE_STATS	stats0;
+	I2CHAL_RATE_STATS	stats1;
+	BYTE				b;
+
+	I2CHALResetRate(addrTestPod);
+	FWriteScratch(0x44);
+
+	I2CHALGetRateStats(addrTestPod, &stats0);
+	I2CSimSetFault(addrTestPod, EIO, 2);
+	TestCheck(FReadScratch(&b) && ( 0x44 == b ), "read after two EIO failures");
+	I2CHALGetRateStats(addrTestPod, &stats1);
+	TestCheck(2 == stats1.cRetry - stats0.cRetry, "a read failing with EIO is retried");
+	TestCheck(stats1.cFail == stats0.cFail, "the retried read doesn't fail");
+
+	I2CHALResetRate(addrTestPod);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestResetNoRetry
+**
+**  Description:
+**      A write of the software reset register of the Platform MCU is
+**      attempted only once, even when its address is NACKed, while the
+**      same NACK on another register is retried.
+*/
+static void
+TestResetNoRetry() {
+
+	I2CHAL_RATE_STATS	stats0;
+	I2CHAL_RATE_STATS	stats1;
+	BOOL				fRet;
+	BYTE				b;
+
+	/* The HAL has no statistics for a slave until its first transaction.
+	*/
+	I2CHALResetRate(addrPlatformMcuI2c);
+	memset(&stats0, 0, sizeof(stats0));
+
+	b = 1;
+	I2CSimSetFault(addrPlatformMcuI2c, ENXIO, 1);
+	fRet = PmcuI2cWrite(fdI2cTest, regaddrSoftwareReset, &b, 1, NULL);
+	I2CHALGetRateStats(addrPlatformMcuI2c, &stats1);
+
+	TestCheck(! fRet, "a NACKed write of the reset register fails");
+	TestCheck(1 == stats1.cTx - stats0.cTx, "the reset register is written once");
+	TestCheck(stats1.cRetry == stats0.cRetry, "the reset register isn't retried");
+	TestCheck(1 == stats1.cFail - stats0.cFail, "the failed reset is counted");
+
+	I2CHALGetRateStats(addrPlatformMcuI2c, &stats0);
+	b = 0;
+	I2CSimSetFault(addrPlatformMcuI2c, ENXIO, 1);
+	fRet = PmcuI2cWrite(fdI2cTest, regaddrFan1Config, &b, 1, NULL);
+	I2CHALGetRateStats(addrPlatformMcuI2c, &stats1);
+
+	TestCheck(fRet, "a NACKed write of another register succeeds");
+	TestCheck(1 == stats1.cRetry - stats0.cRetry, "another register is retried");
+
+	I2CHALResetRate(addrPlatformMcuI2c);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestPodFloor
+**
+**  Description:
+**      Reads of a pod keep at least the turnaround its firmware
+**      requires, however many clean reads there are, and a write to the
+**      pod doesn't lower it.
+*/
+static void
+TestPodFloor() {
+
+	I2CHAL_RATE_STATS	stats;
+	DWORD				itx;
+	DWORD				cok;
+	BYTE				b;
+
+	I2CHALResetRate(addrTestPod);
+	FWriteScratch(0x55);
+
+	cok = 0;
+	for ( itx = 0; itx < ctxRelax; itx++ ) {
+		if ( SyzygyI2cRead(fdI2cTest, addrTestPod, addrTestScratch, &b, 1, NULL) && ( 0x55 == b )) {
+			cok++;
+		}
+	}
+	I2CHALGetRateStats(addrTestPod, &stats);
+
+	TestCheck(ctxRelax == cok, "every pod read succeeds");
+	TestCheck(usSzgTurnaroundMin == stats.usTurnaroundMin, "pod reads have the pod turnaround floor");
+	TestCheck(usSzgTurnaroundMin <= stats.usTurnaround, "the pod turnaround doesn't tighten below the floor");
+
+	FWriteScratch(0x66);
+	I2CHALGetRateStats(addrTestPod, &stats);
+	TestCheck(usSzgTurnaroundMin == stats.usTurnaroundMin, "a pod write doesn't lower the floor");
+
+	I2CHALResetRate(addrTestPod);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestEvict
+**
+**  Description:
+**      More slaves are addressed than the HAL keeps rate controllers
+**      for, with the pod read in between. The controller of the pod
+**      keeps counting, while the least recently used controllers are
+**      discarded.
+*/
+static void
+TestEvict() {
+
+	I2CHAL_RATE_STATS	stats0;
+	I2CHAL_RATE_STATS	stats1;
+	DWORD				iaddr;
+	DWORD				cok;
+	BYTE				b;
+
+	I2CHALResetRate(addrTestPod);
+	FWriteScratch(0x77);
+	I2CHALGetRateStats(addrTestPod, &stats0);
+
+	cok = 0;
+	for ( iaddr = 0; iaddr < caddrEvict; iaddr++ ) {
+		I2CHALSetTurnaroundFloor(addrEvictFirst + iaddr, 0);
+		if ( FReadScratch(&b) && ( 0x77 == b )) {
+			cok++;
+		}
+	}
+	I2CHALGetRateStats(addrTestPod, &stats1);
+
+	TestCheck(caddrEvict == cok, "pod reads succeed while other slaves are addressed");
+	TestCheck(caddrEvict == stats1.cTx - stats0.cTx, "the controller of the pod isn't discarded");
+	TestCheck(! I2CHALGetRateStats(addrEvictFirst, &stats0), "the least recently used controller is discarded");
+	TestCheck(I2CHALGetRateStats(addrEvictFirst + caddrEvict - 1, &stats0), "the most recent controller is kept");
+
+	for ( iaddr = 0; iaddr < caddrEvict; iaddr++ ) {
+		I2CHALResetRate(addrEvictFirst + iaddr);
+	}
+	I2CHALResetRate(addrTestPod);
+}
+
+/* ------------------------------------------------------------ */
+/***    FWriteScratch
+**
+**  Description:
+**      Writes one byte to the scratch address of the test pod.
+*/
+static BOOL
+FWriteScratch(BYTE b) {
+
+	return I2CHALWrite(fdI2cTest, addrTestPod, addrTestScratch, &b, 1, 32, NULL, 0);
+}
+
+/* ------------------------------------------------------------ */
+/***    FReadScratch
+**
+**  Description:
+**      Reads one byte from the scratch address of the test pod.
+*/
+static BOOL
+FReadScratch(BYTE* pb) {
+
+	return I2CHALRead(fdI2cTest, addrTestPod, addrTestScratch, pb, 1, NULL, 0);
+}
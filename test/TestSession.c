@@ -0,0 +1,362 @@
+/************************************************************************/
+/*                                                                      */
+/*  TestSession.c - DpmSession tests against the simulated I2C bus      */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This program checks that concurrent reads of the same Platform MCU  */
+/*  register range share a single bus transaction, that cached values   */
+/*  are served without accessing the bus, that a read issued after a    */
+/*  write doesn't share a fetch that started before it, and that writes */
+/*  made through the session, or by the dpmutil API while the session's */
+/*  bus is locked, invalidate the registers they may have changed.      */
+/*                                                                      */
+/*  It must be built with I2CHAL_SIM defined.                           */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "stdtypes.h"
+#include "dpmutil.h"
+#include "I2CHAL.h"
+#include "I2CSim.h"
+#include "PlatformMCU.h"
+#include "DpmSession.h"
+#include "TestUtil.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+/* Define the number of threads reading at the same time and the
+** turnaround delay that makes each bus transaction last long enough
+** for all of them to arrive while it's in progress.
+*/
+#define cthrdRead			8
+#define cround				20
+#define usTurnaroundSlow	2000
+
+/* Define the turnaround delay of the read that's in progress while a
+** write happens, long enough for the write and the second read to be
+** issued before it ends.
+*/
+#define usTurnaroundFlight	20000
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+typedef struct {
+	WORD	addr;
+	BYTE	cb;
+	BOOL	fOk;
+	BYTE	rgb[4];
+} TEST_READ;
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static DPM_SESSION			sessTest;
+static pthread_barrier_t	barRead;
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static void		TestCoalesce();
+static void		TestWriteDuringFetch();
+static void		TestCache();
+static void		TestWriteInvalidates();
+static void		TestApiInvalidates();
+static void*	PvReadThread(void* pvArg);
+static void*	PvWriteThread(void* pvArg);
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+int
+main() {
+
+	if ( ! DpmSessionOpen(&sessTest) ) {
+		printf("FAIL: DpmSessionOpen\n");
+		return 1;
+	}
+
+	TestCoalesce();
+	TestWriteDuringFetch();
+	TestCache();
+	TestWriteInvalidates();
+	TestApiInvalidates();
+
+	DpmSessionClose(&sessTest);
+
+	return TestResult("TestSession");
+}
+
+/* ------------------------------------------------------------ */
+/***    TestCoalesce
+**
+**  Description:
+**      Several threads read VADJ_STATUS at the same moment with caching
+**      disabled. The reads must be served by fewer bus transactions
+**      than there are reads and every thread must see the register.
+*/
+static void
+TestCoalesce() {
+
+	pthread_t			rgthrd[cthrdRead];
+	TEST_READ			rgread[cthrdRead];
+	DPM_SESSION_STATS	stats0;
+	DPM_SESSION_STATS	stats1;
+	DWORD				ithrd;
+	DWORD				iround;
+	DWORD				cok;
+
+	I2CSimSetTiming(addrPlatformMcuI2c, usTurnaroundSlow, 0);
+	I2CHALSetTurnaroundFloor(addrPlatformMcuI2c, usTurnaroundSlow);
+	DpmSessionSetTtl(&sessTest, regclassStatus, 0);
+	DpmSessionGetStats(&sessTest, &stats0);
+
+	cok = 0;
+	for ( iround = 0; iround < cround; iround++ ) {
+		pthread_barrier_init(&barRead, NULL, cthrdRead);
+		for ( ithrd = 0; ithrd < cthrdRead; ithrd++ ) {
+			memset(&rgread[ithrd], 0, sizeof(TEST_READ));
+			rgread[ithrd].addr = regaddrVadjStatus;
+			rgread[ithrd].cb = 2;
+			pthread_create(&rgthrd[ithrd], NULL, PvReadThread, &rgread[ithrd]);
+		}
+		for ( ithrd = 0; ithrd < cthrdRead; ithrd++ ) {
+			pthread_join(rgthrd[ithrd], NULL);
+			if (( rgread[ithrd].fOk ) && ( 0x03 == rgread[ithrd].rgb[0] ) && ( 0x03 == rgread[ithrd].rgb[1] )) {
+				cok++;
+			}
+		}
+		pthread_barrier_destroy(&barRead);
+	}
+
+	DpmSessionGetStats(&sessTest, &stats1);
+
+	TestCheck(cround * cthrdRead == cok, "every concurrent read returns VADJ_STATUS");
+	TestCheck(0 < stats1.cCoalesced - stats0.cCoalesced, "concurrent reads are coalesced");
+	TestCheck(stats1.cBusRead - stats0.cBusRead < cround * cthrdRead, "coalesced reads save bus transactions");
+	TestCheck(stats1.cBusRead - stats0.cBusRead + stats1.cCoalesced - stats0.cCoalesced == cround * cthrdRead,
+		"every read is either a bus transaction or coalesced");
+
+	I2CSimSetTiming(addrPlatformMcuI2c, 0, 0);
+	I2CHALResetRate(addrPlatformMcuI2c);
+	DpmSessionSetTtl(&sessTest, regclassStatus, usTtlStatusDefault);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestWriteDuringFetch
+**
+**  Description:
+**      A slow read of VADJ_A_VOLTAGE is in progress when the registers
+**      are reported as written by another process. A second read of the
+**      same register issued after that must not share the fetch, which
+**      may return the value the write replaced, and must go to the bus.
+*/
+static void
+TestWriteDuringFetch() {
+
+	pthread_t			rgthrd[2];
+	TEST_READ			rgread[2];
+	DPM_SESSION_STATS	stats0;
+	DPM_SESSION_STATS	stats1;
+	DWORD				ithrd;
+
+	I2CSimSetTiming(addrPlatformMcuI2c, usTurnaroundFlight, 0);
+	I2CHALSetTurnaroundFloor(addrPlatformMcuI2c, usTurnaroundFlight);
+	DpmSessionSetTtl(&sessTest, regclassStatus, 0);
+	DpmSessionGetStats(&sessTest, &stats0);
+
+	memset(rgread, 0, sizeof(rgread));
+	pthread_barrier_init(&barRead, NULL, 1);
+	for ( ithrd = 0; ithrd < 2; ithrd++ ) {
+		rgread[ithrd].addr = regaddrVadjAVoltage;
+		rgread[ithrd].cb = 2;
+	}
+
+	pthread_create(&rgthrd[0], NULL, PvReadThread, &rgread[0]);
+	usleep(usTurnaroundFlight / 4);
+	DpmSessionInvalidate(&sessTest);
+	pthread_create(&rgthrd[1], NULL, PvReadThread, &rgread[1]);
+
+	for ( ithrd = 0; ithrd < 2; ithrd++ ) {
+		pthread_join(rgthrd[ithrd], NULL);
+	}
+	pthread_barrier_destroy(&barRead);
+
+	DpmSessionGetStats(&sessTest, &stats1);
+
+	TestCheck(( rgread[0].fOk ) && ( rgread[1].fOk ), "both reads succeed");
+	TestCheck(stats1.cCoalesced == stats0.cCoalesced, "a read after a write doesn't share an older fetch");
+	TestCheck(2 == stats1.cBusRead - stats0.cBusRead, "the read after the write goes to the bus");
+
+	I2CSimSetTiming(addrPlatformMcuI2c, 0, 0);
+	I2CHALResetRate(addrPlatformMcuI2c);
+	DpmSessionSetTtl(&sessTest, regclassStatus, usTtlStatusDefault);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestCache
+**
+**  Description:
+**      A second read of a static register and of a status register
+**      within its lifetime must not access the bus.
+*/
+static void
+TestCache() {
+
+	DPM_SESSION_STATS	stats0;
+	DPM_SESSION_STATS	stats1;
+	DWORD				pdid;
+	WORD				vadjsts;
+
+	DpmSessionSetTtl(&sessTest, regclassStatus, usTtlForever);
+	DpmSessionInvalidate(&sessTest);
+
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrPDID, (BYTE*)&pdid, 4, NULL), "read PDID");
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrVadjStatus, (BYTE*)&vadjsts, 2, NULL), "read VADJ_STATUS");
+
+	DpmSessionGetStats(&sessTest, &stats0);
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrPDID, (BYTE*)&pdid, 4, NULL), "read PDID again");
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrVadjStatus, (BYTE*)&vadjsts, 2, NULL), "read VADJ_STATUS again");
+	DpmSessionGetStats(&sessTest, &stats1);
+
+	TestCheck(stats1.cBusRead == stats0.cBusRead, "cached reads don't access the bus");
+	TestCheck(stats1.cHit - stats0.cHit == 2, "cached reads are counted as hits");
+
+	DpmSessionSetTtl(&sessTest, regclassStatus, usTtlStatusDefault);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestWriteInvalidates
+**
+**  Description:
+**      With status registers cached forever, another thread overrides
+**      VADJ A. The next read of VADJ_A_VOLTAGE must go to the bus and
+**      return the new voltage, while the PDID stays cached.
+*/
+static void
+TestWriteInvalidates() {
+
+	DPM_SESSION_STATS	stats0;
+	DPM_SESSION_STATS	stats1;
+	pthread_t			thrd;
+	VADJ_OVERRIDE		vadjow;
+	WORD				vltg;
+	DWORD				pdid;
+
+	DpmSessionSetTtl(&sessTest, regclassStatus, usTtlForever);
+	DpmSessionInvalidate(&sessTest);
+
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrPDID, (BYTE*)&pdid, 4, NULL), "read PDID");
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrVadjAVoltage, (BYTE*)&vltg, 2, NULL), "read VADJ_A_VOLTAGE");
+	TestCheck(180 == vltg, "VADJ A starts at 1.8V");
+
+	memset(&vadjow, 0, sizeof(vadjow));
+	vadjow.fOverride = 1;
+	vadjow.fEnable = 1;
+	vadjow.vltgSet = 330;
+	pthread_create(&thrd, NULL, PvWriteThread, &vadjow);
+	pthread_join(thrd, NULL);
+
+	DpmSessionGetStats(&sessTest, &stats0);
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrVadjAVoltage, (BYTE*)&vltg, 2, NULL), "read VADJ_A_VOLTAGE after the write");
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrPDID, (BYTE*)&pdid, 4, NULL), "read PDID after the write");
+	DpmSessionGetStats(&sessTest, &stats1);
+
+	TestCheck(330 == vltg, "the read after a write returns the new voltage");
+	TestCheck(1 == stats1.cBusRead - stats0.cBusRead, "only the invalidated register is read from the bus");
+
+	/* Restore the default voltage.
+	*/
+	vadjow.fOverride = 0;
+	vadjow.vltgSet = 0;
+	pthread_create(&thrd, NULL, PvWriteThread, &vadjow);
+	pthread_join(thrd, NULL);
+
+	DpmSessionSetTtl(&sessTest, regclassStatus, usTtlStatusDefault);
+}
+
+/* ------------------------------------------------------------ */
+/***    TestApiInvalidates
+**
+**  Description:
+**      A dpmutil set function called while the session's bus is locked
+**      runs on the session's controller, and unlocking the bus
+**      invalidates the configuration register it wrote.
+*/
+static void
+TestApiInvalidates() {
+
+	FAN_CONFIGURATION	fcfg;
+	BOOL				fRet;
+
+	DpmSessionSetTtl(&sessTest, regclassConfig, usTtlForever);
+
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrFan1Config, &fcfg.fs, 1, NULL), "read FAN_1_CONFIGURATION");
+	TestCheck(fancfgAutoSpeed == fcfg.fspeed, "fan 1 starts in automatic mode");
+
+	DpmSessionLockBus(&sessTest);
+	fRet = dpmutilFSetFanConfig(0, fFalse, fFalse, fTrue, fancfgMaximumSpeed, fFalse, 0);
+	DpmSessionUnlockBus(&sessTest, fTrue);
+	TestCheck(fRet, "dpmutilFSetFanConfig on a locked session");
+
+	TestCheck(DpmSessionPmcuRead(&sessTest, regaddrFan1Config, &fcfg.fs, 1, NULL), "read FAN_1_CONFIGURATION after the write");
+	TestCheck(fancfgMaximumSpeed == fcfg.fspeed, "the read after the API write returns the new speed");
+
+	DpmSessionSetTtl(&sessTest, regclassConfig, usTtlConfigDefault);
+}
+
+/* ------------------------------------------------------------ */
+/***    PvReadThread
+**
+**  Description:
+**      Waits for every reader, then performs one session read.
+*/
+static void*
+PvReadThread(void* pvArg) {
+
+	TEST_READ*	pread;
+
+	pread = (TEST_READ*)pvArg;
+
+	pthread_barrier_wait(&barRead);
+	pread->fOk = DpmSessionPmcuRead(&sessTest, pread->addr, pread->rgb, pread->cb, NULL);
+
+	return NULL;
+}
+
+/* ------------------------------------------------------------ */
+/***    PvWriteThread
+**
+**  Description:
+**      Writes VADJ_A_OVERRIDE through the session.
+*/
+static void*
+PvWriteThread(void* pvArg) {
+
+	DpmSessionPmcuWrite(&sessTest, regaddrVadjAOverride, (BYTE*)pvArg, 2, NULL);
+
+	return NULL;
+}
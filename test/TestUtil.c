@@ -0,0 +1,91 @@
+/************************************************************************/
+/*                                                                      */
+/*  TestUtil.c - Test program helpers                                   */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This source file contains the helpers shared by the test programs   */
+/*  that are built and run by "make test". Each check that fails is     */
+/*  reported as it happens and the program's exit status tells whether  */
+/*  every check passed.                                                 */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#include <stdio.h>
+#include "stdtypes.h"
+#include "TestUtil.h"
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static DWORD	ccheck = 0;
+static DWORD	cfail = 0;
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+/* ------------------------------------------------------------ */
+/***    TestCheck
+**
+**  Parameters:
+**      fPass           - fTrue if the check passed
+**      szCheck         - description of the check
+**
+**  Return Value:
+**      fPass
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function counts a check and reports it if it failed.
+*/
+BOOL
+TestCheck(BOOL fPass, const char* szCheck) {
+
+	ccheck++;
+	if ( ! fPass ) {
+		cfail++;
+		printf("FAIL: %s\n", szCheck);
+	}
+
+	return fPass;
+}
+
+/* ------------------------------------------------------------ */
+/***    TestResult
+**
+**  Parameters:
+**      szTest          - name of the test program
+**
+**  Return Value:
+**      0 if every check passed, 1 otherwise
+**
+**  Errors:
+**      none
+**
+**  Description:
+**      This function reports the number of checks that passed and
+**      returns the exit status of the test program.
+*/
+int
+TestResult(const char* szTest) {
+
+	printf("%s: %u of %u checks passed\n", szTest, ccheck - cfail, ccheck);
+
+	return ( 0 == cfail ) ? 0 : 1;
+}
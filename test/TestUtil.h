@@ -0,0 +1,32 @@
+/************************************************************************/
+/*                                                                      */
+/*  TestUtil.h - Test program helper declarations                       */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file contains the declarations for the helpers shared   */
+/*  by the test programs that are built and run by "make test".         */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef TESTUTIL_H_
+#define TESTUTIL_H_
+
+#include "stdtypes.h"
+
+/* ------------------------------------------------------------ */
+/*                  Procedure Declarations                      */
+/* ------------------------------------------------------------ */
+
+BOOL	TestCheck(BOOL fPass, const char* szCheck);
+int		TestResult(const char* szTest);
+
+#endif /* TESTUTIL_H_ */
@@ -0,0 +1,503 @@
+/************************************************************************/
+/*                                                                      */
+/*  TestZmodCal.c - Zmod sample calibration kernel tests                */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This program checks that every vectorised implementation of         */
+/*  ZmodCalPackedToVolts and ZmodCalVoltsToPacked that the processor    */
+/*  supports returns results that are bit identical to the scalar       */
+/*  reference implementation.                                           */
+/*                                                                      */
+/*  The kernels of every channel, gain and frequency step of several    */
+/*  ZmodADC, ZmodDigitizer and ZmodDAC calibrations are used, over      */
+/*  streams of 1, 2 and 3 interleaved channels with the code shifted by */
+/*  0, 1 or 2 bits in its word. Every channel of the stream is          */
+/*  converted, from buffers of every length from 0 to twice the widest  */
+/*  vector, filled with in range, out of range, infinite and NaN inputs */
+/*  at every lane position. The words of the other channels and the     */
+/*  slots around each buffer must not be modified. A sweep converts     */
+/*  every 16-bit word.                                                  */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+/* ------------------------------------------------------------ */
+/*              Include File Definitions                        */
+/* ------------------------------------------------------------ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "stdtypes.h"
+#include "ZmodCal.h"
+#include "ZmodADC.h"
+#include "ZmodDAC.h"
+#include "ZmodDigitizer.h"
+#include "TestUtil.h"
+
+/* ------------------------------------------------------------ */
+/*              Miscellaneous Declarations                      */
+/* ------------------------------------------------------------ */
+
+/* Define the widest vector in samples, the number of guard slots kept
+** around each buffer, the number of samples used for sweeps and the
+** widest stream.
+*/
+#define csmpVectorMax		8
+#define csmpTailMax			(2 * csmpVectorMax)
+#define csmpGuard			4
+#define csmpSweep			(65536 + 16)
+#define csmpBuf				(csmpSweep + 2 * csmpGuard + 1)
+#define cwStrideMax			3
+#define cwBuf				((csmpBuf + 1) * cwStrideMax)
+
+#define ckernMax			128
+
+/* Both buffers are filled with this byte. Neither a word holding a
+** shifted 14-bit code nor a voltage computed by a kernel has this
+** pattern, so writes outside the converted samples are seen.
+*/
+#define bGuard				0x5A
+#define wGuard				((INT16)0x5A5A)
+
+/* Define the number of words and voltage slots, from the start of the
+** buffers, that a run of csmp samples starting at word iwFirst uses.
+*/
+#define CwExtent(iwFirst, csmp)	((iwFirst) + ((csmp) + csmpGuard) * cwStrideMax)
+#define CsmpExtent(csmp)		((csmp) + 2 * csmpGuard)
+
+/* ------------------------------------------------------------ */
+/*              Local Type Definitions                          */
+/* ------------------------------------------------------------ */
+
+typedef struct {
+	DWORD	cwStride;
+	BYTE	cbitShift;
+} LAYOUT;
+
+/* ------------------------------------------------------------ */
+/*              Local Variables                                 */
+/* ------------------------------------------------------------ */
+
+static ZMOD_CAL_KERNEL	rgkernAdc[ckernMax];
+static ZMOD_CAL_KERNEL	rgkernDac[ckernMax];
+static DWORD			ckernAdc = 0;
+static DWORD			ckernDac = 0;
+
+static INT16			rgwRef[cwBuf];
+static INT16			rgwDut[cwBuf];
+static float			rgvltRef[csmpBuf];
+static float			rgvltDut[csmpBuf];
+
+static const char*		rgszImpl[] = { "scalar", "SSE2/NEON", "AVX2" };
+
+/* Stream layouts: the Zmod layout, a single channel, and strides that
+** the vectorised implementations leave to the scalar reference.
+*/
+static const LAYOUT		rglay[] = {
+	{ cwZmodStride, cbitZmodShift }, { 2, 0 }, { 1, 0 }, { 1, 2 }, { 3, 1 }
+};
+#define clay			(sizeof(rglay) / sizeof(rglay[0]))
+
+/* Calibration coefficients: ideal, typical and the largest errors a
+** calibration is expected to correct, with both signs.
+*/
+static const float		rgflGain[] = { 0.0f, 0.0213f, -0.0187f, 0.2f, -0.2f };
+static const float		rgflAdd[] = { 0.0f, -0.0104f, 0.0071f, 0.5f, -0.5f };
+#define ccoef			(sizeof(rgflGain) / sizeof(rgflGain[0]))
+
+/* Words that are placed at every lane position: the ends of the range
+** with and without the bits below a shifted code.
+*/
+static const INT16		rgwSpecial[] = {
+	0, 1, -1, 2, -2, 3, -4, 0x7FFF, (INT16)0x8000, 0x7FFC, (INT16)0x8003,
+	0x1FFF, (INT16)0xE000, 0x4000, (INT16)0xBFFF
+};
+#define cwSpecial		(sizeof(rgwSpecial) / sizeof(rgwSpecial[0]))
+
+static float			rgvltSpecial[32];
+static DWORD			cvltSpecial = 0;
+
+/* ------------------------------------------------------------ */
+/*              Forward Declarations                            */
+/* ------------------------------------------------------------ */
+
+static void		BuildKernels();
+static void		BuildSpecialVolts();
+static DWORD	CmismatchTails(const LAYOUT* play, const ZMOD_CAL_KERNEL* pkern, BOOL fCodes);
+static DWORD	CmismatchSweep(const LAYOUT* play, const ZMOD_CAL_KERNEL* pkern, BOOL fCodes);
+static DWORD	CmismatchRun(const LAYOUT* play, const ZMOD_CAL_KERNEL* pkern, BOOL fCodes, DWORD iwFirst, DWORD csmp);
+static DWORD	CwForeign(const INT16* rgw, DWORD cwStride, DWORD iwFirst, DWORD csmp);
+static void		FillGuard(DWORD iwFirst, DWORD csmp);
+
+/* ------------------------------------------------------------ */
+/*              Procedure Definitions                           */
+/* ------------------------------------------------------------ */
+
+int
+main() {
+
+	char		szCheck[128];
+	ZMOD_SAMPLE	rgsmp[4];
+	INT16		rgw[8];
+	float		rgvlt[8];
+	BYTE		impl;
+	BYTE		implGot;
+	DWORD		ikern;
+	DWORD		ilay;
+	DWORD		cmismatch;
+
+	BuildKernels();
+	BuildSpecialVolts();
+
+	TestCheck(( 0 < ckernAdc ) && ( 0 < ckernDac ), "every calibration produces kernels");
+
+	for ( impl = zmodcalimplScalar; impl <= zmodcalimplAvx2; impl++ ) {
+		implGot = ZmodCalSetImpl(impl);
+		if ( implGot != impl ) {
+			printf("TestZmodCal: %s not supported, skipped\n", rgszImpl[impl]);
+			continue;
+		}
+
+		cmismatch = 0;
+		for ( ilay = 0; ilay < clay; ilay++ ) {
+			for ( ikern = 0; ikern < ckernAdc; ikern++ ) {
+				cmismatch += CmismatchTails(&rglay[ilay], &rgkernAdc[ikern], fTrue);
+				cmismatch += CmismatchSweep(&rglay[ilay], &rgkernAdc[ikern], fTrue);
+			}
+		}
+		snprintf(szCheck, sizeof(szCheck), "%s ZmodCalPackedToVolts matches the reference", rgszImpl[impl]);
+		TestCheck(0 == cmismatch, szCheck);
+
+		cmismatch = 0;
+		for ( ilay = 0; ilay < clay; ilay++ ) {
+			for ( ikern = 0; ikern < ckernDac; ikern++ ) {
+				cmismatch += CmismatchTails(&rglay[ilay], &rgkernDac[ikern], fFalse);
+				cmismatch += CmismatchSweep(&rglay[ilay], &rgkernDac[ikern], fFalse);
+			}
+		}
+		snprintf(szCheck, sizeof(szCheck), "%s ZmodCalVoltsToPacked matches the reference", rgszImpl[impl]);
+		TestCheck(0 == cmismatch, szCheck);
+	}
+
+	/* The reference must sign extend the code of a left justified word,
+	** discarding the bits below it.
+	*/
+	rgw[0] = 0x7FFF;
+	rgw[1] = (INT16)0x8003;
+	rgw[2] = -1;
+	rgw[3] = 4;
+	ZmodCalPackedToVoltsScalar(&rgkernAdc[ckernAdc - 1], rgw, 1, cbitZmodShift, rgvlt, 4);
+	TestCheck(( (float)codeZmodMax == rgvlt[0] ) && ( (float)codeZmodMin == rgvlt[1] ) &&
+		( -1.0f == rgvlt[2] ) && ( 1.0f == rgvlt[3] ), "packed codes are sign extended and shifted");
+
+	/* The reference must saturate, map NaN to the minimum and clear the
+	** bits below the code.
+	*/
+	rgvlt[0] = NAN;
+	rgvlt[1] = INFINITY;
+	rgvlt[2] = -INFINITY;
+	rgvlt[3] = 1000.0f;
+	memset(rgw, bGuard, sizeof(rgw));
+	ZmodCalVoltsToPackedScalar(&rgkernDac[0], rgvlt, rgw, 2, cbitZmodShift, 4);
+	TestCheck((INT16)(codeZmodMin * 4) == rgw[0], "NaN converts to the minimum code");
+	TestCheck((INT16)(codeZmodMax * 4) == rgw[2], "+inf saturates to the maximum code");
+	TestCheck((INT16)(codeZmodMin * 4) == rgw[4], "-inf saturates to the minimum code");
+	TestCheck((INT16)(codeZmodMax * 4) == rgw[6], "out of range voltages saturate");
+	TestCheck(0 == CwForeign(rgw, 2, 0, 4), "the other channel's words are not written");
+
+	/* The unpacked convenience functions must agree with the packed ones.
+	*/
+	rgsmp[0].vlt = NAN;
+	rgsmp[1].vlt = INFINITY;
+	rgsmp[2].vlt = -INFINITY;
+	rgsmp[3].vlt = 1000.0f;
+	ZmodCalVoltsToCodes(&rgkernDac[0], rgsmp, 4);
+	TestCheck(( codeZmodMin == rgsmp[0].code ) && ( codeZmodMax == rgsmp[1].code ) &&
+		( codeZmodMin == rgsmp[2].code ) && ( codeZmodMax == rgsmp[3].code ), "ZmodCalVoltsToCodes saturates");
+
+	rgsmp[0].code = codeZmodMax;
+	rgsmp[1].code = codeZmodMin;
+	rgsmp[2].code = -1;
+	rgsmp[3].code = 1;
+	ZmodCalCodesToVolts(&rgkernAdc[ckernAdc - 1], rgsmp, 4);
+	TestCheck(( (float)codeZmodMax == rgsmp[0].vlt ) && ( (float)codeZmodMin == rgsmp[1].vlt ) &&
+		( -1.0f == rgsmp[2].vlt ) && ( 1.0f == rgsmp[3].vlt ), "ZmodCalCodesToVolts matches the packed reference");
+
+	ZmodCalSetImpl(zmodcalimplAvx2);
+
+	return TestResult("TestZmodCal");
+}
+
+/* ------------------------------------------------------------ */
+/***    BuildKernels
+**
+**  Description:
+**      Builds the kernels of every channel and gain (or frequency step)
+**      of a set of calibrations, plus kernels whose results land exactly
+**      half way between two codes. The last ADC kernel is the identity.
+*/
+static void
+BuildKernels() {
+
+	ZMOD_ADC_CAL		adcal;
+	ZMOD_DAC_CAL		dacal;
+	ZMOD_DIGITIZER_CAL	dgcal;
+	DWORD				icoef;
+	BYTE				ch;
+	BYTE				igain;
+	BYTE				ihz;
+
+	for ( icoef = 0; icoef < ccoef; icoef++ ) {
+		memset(&adcal, 0, sizeof(adcal));
+		memset(&dacal, 0, sizeof(dacal));
+		memset(&dgcal, 0, sizeof(dgcal));
+		for ( ch = 0; ch < 2; ch++ ) {
+			for ( igain = 0; igain < 2; igain++ ) {
+				/* Use different coefficients for each channel and gain.
+				*/
+				adcal.cal[ch][igain][0] = rgflGain[(icoef + ch + igain) % ccoef];
+				adcal.cal[ch][igain][1] = rgflAdd[(icoef + 2*ch + igain) % ccoef];
+				dacal.cal[ch][igain][0] = rgflGain[(icoef + ch + igain) % ccoef];
+				dacal.cal[ch][igain][1] = rgflAdd[(icoef + 2*ch + igain) % ccoef];
+			}
+			for ( ihz = 0; ihz < cbDigitizerCalibHzSteps; ihz++ ) {
+				dgcal.cal[ihz][ch][0] = rgflGain[(icoef + ch + ihz) % ccoef];
+				dgcal.cal[ihz][ch][1] = rgflAdd[(icoef + ch + 2*ihz) % ccoef];
+			}
+		}
+
+		for ( ch = 0; ch < 2; ch++ ) {
+			for ( igain = 0; igain < 2; igain++ ) {
+				FZmodADCCalGetKernel(adcal, ch, igain, &rgkernAdc[ckernAdc++]);
+				FZmodDACCalGetKernel(dacal, ch, igain, &rgkernDac[ckernDac++]);
+			}
+			for ( ihz = 0; ihz < cbDigitizerCalibHzSteps; ihz++ ) {
+				FZmodDigitizerCalGetKernel(dgcal, ihz, ch, &rgkernAdc[ckernAdc++]);
+			}
+		}
+	}
+
+	/* Kernels that place results on rounding ties.
+	*/
+	rgkernDac[ckernDac].flScale = 1.0f;
+	rgkernDac[ckernDac++].flOffset = 0.5f;
+	rgkernDac[ckernDac].flScale = 2.0f;
+	rgkernDac[ckernDac++].flOffset = 0.0f;
+	rgkernAdc[ckernAdc].flScale = 1.0f;
+	rgkernAdc[ckernAdc++].flOffset = 0.0f;
+}
+
+/* ------------------------------------------------------------ */
+/***    BuildSpecialVolts
+**
+**  Description:
+**      Builds the list of voltages that are placed at every lane
+**      position: zeros, ties, range limits, values far out of range,
+**      infinities, NaNs and denormals.
+*/
+static void
+BuildSpecialVolts() {
+
+	float	rgvlt[] = {
+		0.0f, -0.0f, 0.25f, -0.25f, 0.5f, -0.5f, 1.5f, -1.5f, 2.5f, -2.5f,
+		0.999f, -0.999f, 1.0f, -1.0f, 5.0f, -5.0f, 4095.75f, -4096.25f,
+		8191.5f, -8192.5f, 1.0e3f, -1.0e3f, 1.0e30f, -1.0e30f,
+		FLT_MAX, -FLT_MAX, FLT_MIN / 4.0f, INFINITY, -INFINITY, NAN, -NAN
+	};
+
+	cvltSpecial = sizeof(rgvlt) / sizeof(rgvlt[0]);
+	memcpy(rgvltSpecial, rgvlt, sizeof(rgvlt));
+}
+
+/* ------------------------------------------------------------ */
+/***    CmismatchTails
+**
+**  Description:
+**      Converts buffers of every length from 0 to csmpTailMax, for every
+**      channel of the stream and an unaligned start, with every
+**      rotation of the special inputs. Returns the number of runs whose
+**      result differs from the reference.
+*/
+static DWORD
+CmismatchTails(const LAYOUT* play, const ZMOD_CAL_KERNEL* pkern, BOOL fCodes) {
+
+	DWORD	cmismatch;
+	DWORD	iwFirst;
+	DWORD	csmp;
+	DWORD	irot;
+	DWORD	crot;
+	DWORD	ismp;
+
+	cmismatch = 0;
+	crot = fCodes ? cwSpecial : cvltSpecial;
+
+	for ( iwFirst = csmpGuard * cwStrideMax; iwFirst <= csmpGuard * cwStrideMax + play->cwStride; iwFirst++ ) {
+		for ( csmp = 0; csmp <= csmpTailMax; csmp++ ) {
+			for ( irot = 0; irot < crot; irot++ ) {
+				FillGuard(iwFirst, csmp);
+				for ( ismp = 0; ismp < csmp; ismp++ ) {
+					if ( fCodes ) {
+						rgwRef[iwFirst + ismp * play->cwStride] = rgwSpecial[(ismp + irot) % crot];
+					}
+					else {
+						rgvltRef[csmpGuard + ismp] = rgvltSpecial[(ismp + irot) % crot];
+					}
+				}
+				cmismatch += CmismatchRun(play, pkern, fCodes, iwFirst, csmp);
+			}
+		}
+	}
+
+	return cmismatch;
+}
+
+/* ------------------------------------------------------------ */
+/***    CmismatchSweep
+**
+**  Description:
+**      Converts a single long buffer of the last channel of the stream
+**      that holds every 16-bit word, or voltages spanning beyond both
+**      ends of the DAC range. Returns 1 if the result differs from the
+**      reference.
+*/
+static DWORD
+CmismatchSweep(const LAYOUT* play, const ZMOD_CAL_KERNEL* pkern, BOOL fCodes) {
+
+	DWORD	iwFirst;
+	DWORD	ismp;
+	float	vltMax;
+
+	iwFirst = csmpGuard * cwStrideMax + play->cwStride - 1;
+
+	FillGuard(iwFirst, csmpSweep);
+
+	/* The voltage that maps to the end of the code range.
+	*/
+	vltMax = (float)ccodeZmodHalf / pkern->flScale;
+
+	for ( ismp = 0; ismp < csmpSweep; ismp++ ) {
+		if ( fCodes ) {
+			rgwRef[iwFirst + ismp * play->cwStride] = (INT16)(WORD)(ismp + 0x8000);
+		}
+		else {
+			rgvltRef[csmpGuard + ismp] = -1.2f * vltMax + (2.4f * vltMax * ismp) / csmpSweep;
+		}
+	}
+
+	return CmismatchRun(play, pkern, fCodes, iwFirst, csmpSweep);
+}
+
+/* ------------------------------------------------------------ */
+/***    CmismatchRun
+**
+**  Description:
+**      Converts the inputs in rgwRef or rgvltRef with both
+**      implementations and compares the whole output buffers, guard
+**      slots included. The reference must not write the words of the
+**      other channels. Returns 1 and reports the first differing slot
+**      if they differ.
+*/
+static DWORD
+CmismatchRun(const LAYOUT* play, const ZMOD_CAL_KERNEL* pkern, BOOL fCodes, DWORD iwFirst, DWORD csmp) {
+
+	DWORD	ismp;
+	DWORD	iw;
+	DWORD	cwCmp;
+	DWORD	csmpCmp;
+	DWORD	dwRef;
+	DWORD	dwDut;
+
+	cwCmp = CwExtent(iwFirst, csmp);
+	csmpCmp = CsmpExtent(csmp);
+	memcpy(rgwDut, rgwRef, cwCmp * sizeof(INT16));
+	memcpy(rgvltDut, rgvltRef, csmpCmp * sizeof(float));
+
+	if ( fCodes ) {
+		ZmodCalPackedToVoltsScalar(pkern, &rgwRef[iwFirst], play->cwStride, play->cbitShift, &rgvltRef[csmpGuard], csmp);
+		ZmodCalPackedToVolts(pkern, &rgwDut[iwFirst], play->cwStride, play->cbitShift, &rgvltDut[csmpGuard], csmp);
+	}
+	else {
+		ZmodCalVoltsToPackedScalar(pkern, &rgvltRef[csmpGuard], &rgwRef[iwFirst], play->cwStride, play->cbitShift, csmp);
+		ZmodCalVoltsToPacked(pkern, &rgvltDut[csmpGuard], &rgwDut[iwFirst], play->cwStride, play->cbitShift, csmp);
+
+		if ( 0 != CwForeign(rgwRef, play->cwStride, iwFirst, csmp) ) {
+			printf("mismatch: the reference wrote words of another channel\n");
+			return 1;
+		}
+	}
+
+	if (( 0 == memcmp(rgwRef, rgwDut, cwCmp * sizeof(INT16)) ) &&
+		( 0 == memcmp(rgvltRef, rgvltDut, csmpCmp * sizeof(float)) )) {
+		return 0;
+	}
+
+	for ( iw = 0; iw < cwCmp; iw++ ) {
+		if ( rgwRef[iw] != rgwDut[iw] ) {
+			printf("mismatch: kernel %g/%g, stride %u, shift %u, %u samples, word %u: 0x%04X != 0x%04X\n",
+				pkern->flScale, pkern->flOffset, play->cwStride, play->cbitShift, csmp, iw,
+				(WORD)rgwDut[iw], (WORD)rgwRef[iw]);
+			return 1;
+		}
+	}
+
+	for ( ismp = 0; ismp < csmpCmp; ismp++ ) {
+		memcpy(&dwRef, &rgvltRef[ismp], sizeof(dwRef));
+		memcpy(&dwDut, &rgvltDut[ismp], sizeof(dwDut));
+		if ( dwRef != dwDut ) {
+			printf("mismatch: kernel %g/%g, stride %u, shift %u, %u samples, slot %u: 0x%08X != 0x%08X\n",
+				pkern->flScale, pkern->flOffset, play->cwStride, play->cbitShift, csmp, ismp,
+				dwDut, dwRef);
+			break;
+		}
+	}
+
+	return 1;
+}
+
+/* ------------------------------------------------------------ */
+/***    CwForeign
+**
+**  Description:
+**      Returns the number of words between the first and last sample of
+**      a channel that belong to other channels and no longer hold the
+**      guard pattern.
+*/
+static DWORD
+CwForeign(const INT16* rgw, DWORD cwStride, DWORD iwFirst, DWORD csmp) {
+
+	DWORD	iw;
+	DWORD	cw;
+
+	cw = 0;
+	for ( iw = iwFirst; iw < iwFirst + csmp * cwStride; iw++ ) {
+		if (( 0 != (iw - iwFirst) % cwStride ) && ( wGuard != rgw[iw] )) {
+			cw++;
+		}
+	}
+
+	return cw;
+}
+
+/* ------------------------------------------------------------ */
+/***    FillGuard
+**
+**  Description:
+**      Fills the part of the reference buffers used by a run with the
+**      guard pattern.
+*/
+static void
+FillGuard(DWORD iwFirst, DWORD csmp) {
+
+	memset(rgwRef, bGuard, CwExtent(iwFirst, csmp) * sizeof(INT16));
+	memset(rgvltRef, bGuard, CsmpExtent(csmp) * sizeof(float));
+}
@@ -0,0 +1,84 @@
+/************************************************************************/
+/*                                                                      */
+/*  fuse.h - Minimal libfuse3 declarations for the DpmFs test           */
+/*                                                                      */
+/************************************************************************/
+/*  Copyright 2026, Digilent Inc.                                       */
+/************************************************************************/
+/*  Module Description:                                                 */
+/*                                                                      */
+/*  This header file declares the subset of the libfuse3 high level API */
+/*  used by DpmFs.c, with the same names and signatures as <fuse.h>     */
+/*  from libfuse 3.x. It lets TestDpmFs call the filesystem operations  */
+/*  directly on machines where libfuse3 isn't installed. When the       */
+/*  fuse3 package is found by pkg-config the test is built against the  */
+/*  real header instead.                                                */
+/*                                                                      */
+/*  fuse_main always fails, since mounting requires the real library.   */
+/*                                                                      */
+/************************************************************************/
+/*  Revision History:                                                   */
+/*                                                                      */
+/*  10/17/2026: created                                                 */
+/*                                                                      */
+/************************************************************************/
+
+#ifndef FUSE_H_
+#define FUSE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+/* ------------------------------------------------------------ */
+/*                  General Type Declarations                   */
+/* ------------------------------------------------------------ */
+
+enum fuse_readdir_flags {
+	FUSE_READDIR_PLUS = (1 << 0)
+};
+
+enum fuse_fill_dir_flags {
+	FUSE_FILL_DIR_PLUS = (1 << 1)
+};
+
+typedef int (*fuse_fill_dir_t)(void* buf, const char* name, const struct stat* stbuf, off_t off, enum fuse_fill_dir_flags flags);
+
+struct fuse_file_info {
+	int32_t		flags;
+	uint32_t	writepage : 1;
+	uint32_t	direct_io : 1;
+	uint32_t	keep_cache : 1;
+	uint64_t	fh;
+};
+
+struct fuse_operations {
+	int	(*getattr)(const char* path, struct stat* stbuf, struct fuse_file_info* fi);
+	int	(*truncate)(const char* path, off_t size, struct fuse_file_info* fi);
+	int	(*open)(const char* path, struct fuse_file_info* fi);
+	int	(*read)(const char* path, char* buf, size_t size, off_t off, struct fuse_file_info* fi);
+	int	(*write)(const char* path, const char* buf, size_t size, off_t off, struct fuse_file_info* fi);
+	int	(*readdir)(const char* path, void* buf, fuse_fill_dir_t filler, off_t off, struct fuse_file_info* fi, enum fuse_readdir_flags flags);
+};
+
+/* ------------------------------------------------------------ */
+/*                  Procedure Declarations                      */
+/* ------------------------------------------------------------ */
+
+static inline int
+fuse_main_real(int argc, char* argv[], const struct fuse_operations* op, size_t op_size, void* private_data) {
+
+	(void)argc;
+	(void)argv;
+	(void)op;
+	(void)op_size;
+	(void)private_data;
+
+	return -1;
+}
+
+#define fuse_main(argc, argv, op, private_data) \
+	fuse_main_real(argc, argv, op, sizeof(*(op)), private_data)
+
+#endif /* FUSE_H_ */